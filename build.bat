@@ -21,8 +21,10 @@ if "%release%"=="1" set cl_compile=%cl_release_common%
 
 :: --- Example Compile/Link Definitions --------------------------------------
 set cl_example_includes=/I..\extern\SDL3\win\include /I..\extern\HandmadeMath /I..\extern\imgui /I..\extern\im3d
-set cl_example_debug=%cl_debug_common% /I..\extern\SDL3_shadercross\win\include %cl_example_includes%
-set cl_example_release=%cl_release_common% %cl_example_includes%
+:: Only embed the shader formats of the Windows GPU drivers.
+set cl_example_shaders=/DIM3D_SDL3_GPU_SHADERS_DXIL /DIM3D_SDL3_GPU_SHADERS_SPIRV
+set cl_example_debug=%cl_debug_common% /I..\extern\SDL3_shadercross\win\include %cl_example_includes% %cl_example_shaders%
+set cl_example_release=%cl_release_common% %cl_example_includes% %cl_example_shaders%
 set cl_example_link=/link ..\extern\SDL3\win\lib\x64\SDL3.lib shell32.lib /subsystem:console
 if "%debug%"=="1" set cl_example_compile=%cl_example_debug%
 if "%release%"=="1" set cl_example_compile=%cl_example_release%
@@ -31,6 +33,7 @@ if "%release%"=="1" set cl_example_compile=%cl_example_release%
 set shadercross=call ..\extern\SDL3_shadercross\win\bin\shadercross.exe
 set shadercross_vertex=%shadercross% -t vertex -DVERTEX_SHADER
 set shadercross_fragment=%shadercross% -t fragment -DFRAGMENT_SHADER
+set shadercross_compute=%shadercross% -t compute -DCOMPUTE_SHADER
 
 :: --- Prep Directories -------------------------------------------------------
 set build_dir_debug=build_debug
@@ -48,29 +51,74 @@ echo Compiling shaders...
 %shadercross_vertex% -DPRIMITIVE_KIND_POINTS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_points.vert.dxil || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_POINTS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_points.frag.dxil || exit /b 1
 %shadercross_vertex% -DPRIMITIVE_KIND_LINES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_lines.vert.dxil || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_LINES -DMESH_INSTANCES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_mesh_lines.vert.dxil || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_LINES -DPARAMETRIC_SHAPES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_shapes.vert.dxil || exit /b 1
+%shadercross_vertex% -DSHAPE_IMPOSTORS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_impostors.vert.dxil || exit /b 1
+%shadercross_fragment% -DSHAPE_IMPOSTORS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_impostors.frag.dxil || exit /b 1
+%shadercross_vertex% -DOVERLAY_COMPOSITE ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_overlay.vert.dxil || exit /b 1
+%shadercross_fragment% -DOVERLAY_COMPOSITE ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_overlay.frag.dxil || exit /b 1
+%shadercross_vertex% -DTEXT_GLYPHS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_text.vert.dxil || exit /b 1
+%shadercross_fragment% -DTEXT_GLYPHS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_text.frag.dxil || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_LINES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_lines.frag.dxil || exit /b 1
 %shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_triangles.vert.dxil || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES -DINDEXED_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_indexed_triangles.vert.dxil || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES -DMESH_INSTANCES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_mesh_triangles.vert.dxil || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_triangles.frag.dxil || exit /b 1
+%shadercross_compute% -DCULL_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_cull.comp.dxil || exit /b 1
+%shadercross_compute% -DSORT_KEYS_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_keys.comp.dxil || exit /b 1
+%shadercross_compute% -DSORT_COUNT_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_count.comp.dxil || exit /b 1
+%shadercross_compute% -DSORT_SCAN_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_scan.comp.dxil || exit /b 1
+%shadercross_compute% -DSORT_SCATTER_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_scatter.comp.dxil || exit /b 1
 
 %shadercross_vertex% -DPRIMITIVE_KIND_POINTS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_points.vert.spv || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_POINTS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_points.frag.spv || exit /b 1
 %shadercross_vertex% -DPRIMITIVE_KIND_LINES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_lines.vert.spv || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_LINES -DMESH_INSTANCES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_mesh_lines.vert.spv || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_LINES -DPARAMETRIC_SHAPES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_shapes.vert.spv || exit /b 1
+%shadercross_vertex% -DSHAPE_IMPOSTORS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_impostors.vert.spv || exit /b 1
+%shadercross_fragment% -DSHAPE_IMPOSTORS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_impostors.frag.spv || exit /b 1
+%shadercross_vertex% -DOVERLAY_COMPOSITE ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_overlay.vert.spv || exit /b 1
+%shadercross_fragment% -DOVERLAY_COMPOSITE ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_overlay.frag.spv || exit /b 1
+%shadercross_vertex% -DTEXT_GLYPHS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_text.vert.spv || exit /b 1
+%shadercross_fragment% -DTEXT_GLYPHS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_text.frag.spv || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_LINES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_lines.frag.spv || exit /b 1
 %shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_triangles.vert.spv || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES -DINDEXED_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_indexed_triangles.vert.spv || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES -DMESH_INSTANCES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_mesh_triangles.vert.spv || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_triangles.frag.spv || exit /b 1
+%shadercross_compute% -DCULL_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_cull.comp.spv || exit /b 1
+%shadercross_compute% -DSORT_KEYS_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_keys.comp.spv || exit /b 1
+%shadercross_compute% -DSORT_COUNT_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_count.comp.spv || exit /b 1
+%shadercross_compute% -DSORT_SCAN_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_scan.comp.spv || exit /b 1
+%shadercross_compute% -DSORT_SCATTER_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_scatter.comp.spv || exit /b 1
 
 %shadercross_vertex% -DPRIMITIVE_KIND_POINTS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_points.vert.msl || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_POINTS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_points.frag.msl || exit /b 1
 %shadercross_vertex% -DPRIMITIVE_KIND_LINES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_lines.vert.msl || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_LINES -DMESH_INSTANCES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_mesh_lines.vert.msl || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_LINES -DPARAMETRIC_SHAPES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_shapes.vert.msl || exit /b 1
+%shadercross_vertex% -DSHAPE_IMPOSTORS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_impostors.vert.msl || exit /b 1
+%shadercross_fragment% -DSHAPE_IMPOSTORS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_impostors.frag.msl || exit /b 1
+%shadercross_vertex% -DOVERLAY_COMPOSITE ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_overlay.vert.msl || exit /b 1
+%shadercross_fragment% -DOVERLAY_COMPOSITE ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_overlay.frag.msl || exit /b 1
+%shadercross_vertex% -DTEXT_GLYPHS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_text.vert.msl || exit /b 1
+%shadercross_fragment% -DTEXT_GLYPHS ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_text.frag.msl || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_LINES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_lines.frag.msl || exit /b 1
 %shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_triangles.vert.msl || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES -DINDEXED_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_indexed_triangles.vert.msl || exit /b 1
+%shadercross_vertex% -DPRIMITIVE_KIND_TRIANGLES -DMESH_INSTANCES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_mesh_triangles.vert.msl || exit /b 1
 %shadercross_fragment% -DPRIMITIVE_KIND_TRIANGLES ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_triangles.frag.msl || exit /b 1
+%shadercross_compute% -DCULL_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_cull.comp.msl || exit /b 1
+%shadercross_compute% -DSORT_KEYS_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_keys.comp.msl || exit /b 1
+%shadercross_compute% -DSORT_COUNT_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_count.comp.msl || exit /b 1
+%shadercross_compute% -DSORT_SCAN_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_scan.comp.msl || exit /b 1
+%shadercross_compute% -DSORT_SCATTER_SHADER ..\src\im3d_sdl3_gpu.hlsl -o .shaders\im3d_sort_scatter.comp.msl || exit /b 1
 
 echo Compiling shaders_to_c_arrays...
 %cl_compile% ..\src\shaders_to_c_arrays.cpp -DOUT_DIR=\"%root_dir%/src\" /link /out:shaders_to_c_arrays.exe || exit /b 1
 
 echo Exporting shaders to C arrays...
-shaders_to_c_arrays.exe || exit /b 1
+shaders_to_c_arrays.exe --compress || exit /b 1
 )
 
 echo Compiling example...
@@ -92,4 +140,17 @@ popd
 :: --- Copy DLL's -------------------------------------------------------------
 if not exist %build_dir%\SDL3.dll copy extern\SDL3\win\lib\x64\SDL3.dll %build_dir% >nul
 
+:: --- Run Tests --------------------------------------------------------------
+if "%tests%"=="1" (
+pushd %build_dir%
+echo Compiling tests...
+%cl_example_compile% ..\tests\im3d_sdl3_gpu_tests.cpp ^
+                     ..\extern\im3d\im3d.cpp ^
+                     %cl_example_link% /out:im3d_sdl3_gpu_tests.exe || exit /b 1
+
+echo Running tests...
+im3d_sdl3_gpu_tests.exe || exit /b 1
+popd
+)
+
 echo Done^^!
@@ -37,10 +37,12 @@ cd "$source_dir"
 debug=0
 release=0
 shaders=0
+tests=0
 for arg in "$@"; do
   if [ "$arg" == "debug" ]; then debug=1; fi
   if [ "$arg" == "release" ]; then release=1; fi
   if [ "$arg" == "shaders" ]; then shaders=1; fi
+  if [ "$arg" == "tests" ]; then tests=1; fi
 done
 if [ $release -ne 1 ]; then debug=1; fi
 if [ $debug -eq 1 ]; then release=0 && echo "[debug mode]"; fi
@@ -55,8 +57,10 @@ if [ $release -eq 1 ]; then cc_compile="$cc_release_common"; fi
 
 # --- Example Compile/Link Definitions ---------------------------------------
 cc_example_includes="-I../extern/SDL3/linux/include -I../extern/HandmadeMath -I../extern/imgui -I../extern/im3d"
-cc_example_debug="${cc_debug_common} -DRESOURCES_PATH=\"${source_dir}/\" -I../extern/SDL3_shadercross/linux/include ${cc_example_includes}"
-cc_example_release="${cc_release_common} ${cc_example_includes}"
+# Only embed the shader format of the Linux GPU driver.
+cc_example_shaders="-DIM3D_SDL3_GPU_SHADERS_SPIRV"
+cc_example_debug="${cc_debug_common} -DRESOURCES_PATH=\"${source_dir}/\" -I../extern/SDL3_shadercross/linux/include ${cc_example_includes} ${cc_example_shaders}"
+cc_example_release="${cc_release_common} ${cc_example_includes} ${cc_example_shaders}"
 cc_example_link_common="-L../extern/SDL3/linux/lib -lSDL3 -Wl,-rpath,\$ORIGIN"
 cc_example_link_debug="-L../extern/SDL3_shadercross/linux/lib -lSDL3_shadercross ${cc_example_link_common}"
 cc_example_link_release="${cc_example_link_common}"
@@ -69,6 +73,7 @@ if [ $release -eq 1 ]; then cc_example_link="$cc_example_link_release"; fi
 shadercross="../extern/SDL3_shadercross/linux/bin/shadercross"
 shadercross_vertex="$shadercross -t vertex -DVERTEX_SHADER"
 shadercross_fragment="$shadercross -t fragment -DFRAGMENT_SHADER"
+shadercross_compute="$shadercross -t compute -DCOMPUTE_SHADER"
 
 # --- Prep Directories -------------------------------------------------------
 build_dir_debug="build_debug"
@@ -86,29 +91,74 @@ if [ $shaders -eq 1 ]; then
   $shadercross_vertex -DPRIMITIVE_KIND_POINTS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_points.vert.dxil || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_POINTS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_points.frag.dxil || exit 1
   $shadercross_vertex -DPRIMITIVE_KIND_LINES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_lines.vert.dxil || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_LINES -DMESH_INSTANCES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_mesh_lines.vert.dxil || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_LINES -DPARAMETRIC_SHAPES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_shapes.vert.dxil || exit 1
+  $shadercross_vertex -DSHAPE_IMPOSTORS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_impostors.vert.dxil || exit 1
+  $shadercross_fragment -DSHAPE_IMPOSTORS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_impostors.frag.dxil || exit 1
+  $shadercross_vertex -DOVERLAY_COMPOSITE ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_overlay.vert.dxil || exit 1
+  $shadercross_fragment -DOVERLAY_COMPOSITE ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_overlay.frag.dxil || exit 1
+  $shadercross_vertex -DTEXT_GLYPHS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_text.vert.dxil || exit 1
+  $shadercross_fragment -DTEXT_GLYPHS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_text.frag.dxil || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_LINES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_lines.frag.dxil || exit 1
   $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_triangles.vert.dxil || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES -DINDEXED_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_indexed_triangles.vert.dxil || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES -DMESH_INSTANCES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_mesh_triangles.vert.dxil || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_triangles.frag.dxil || exit 1
+  $shadercross_compute -DCULL_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_cull.comp.dxil || exit 1
+  $shadercross_compute -DSORT_KEYS_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_keys.comp.dxil || exit 1
+  $shadercross_compute -DSORT_COUNT_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_count.comp.dxil || exit 1
+  $shadercross_compute -DSORT_SCAN_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_scan.comp.dxil || exit 1
+  $shadercross_compute -DSORT_SCATTER_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_scatter.comp.dxil || exit 1
 
   $shadercross_vertex -DPRIMITIVE_KIND_POINTS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_points.vert.spv || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_POINTS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_points.frag.spv || exit 1
   $shadercross_vertex -DPRIMITIVE_KIND_LINES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_lines.vert.spv || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_LINES -DMESH_INSTANCES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_mesh_lines.vert.spv || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_LINES -DPARAMETRIC_SHAPES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_shapes.vert.spv || exit 1
+  $shadercross_vertex -DSHAPE_IMPOSTORS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_impostors.vert.spv || exit 1
+  $shadercross_fragment -DSHAPE_IMPOSTORS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_impostors.frag.spv || exit 1
+  $shadercross_vertex -DOVERLAY_COMPOSITE ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_overlay.vert.spv || exit 1
+  $shadercross_fragment -DOVERLAY_COMPOSITE ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_overlay.frag.spv || exit 1
+  $shadercross_vertex -DTEXT_GLYPHS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_text.vert.spv || exit 1
+  $shadercross_fragment -DTEXT_GLYPHS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_text.frag.spv || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_LINES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_lines.frag.spv || exit 1
   $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_triangles.vert.spv || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES -DINDEXED_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_indexed_triangles.vert.spv || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES -DMESH_INSTANCES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_mesh_triangles.vert.spv || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_triangles.frag.spv || exit 1
+  $shadercross_compute -DCULL_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_cull.comp.spv || exit 1
+  $shadercross_compute -DSORT_KEYS_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_keys.comp.spv || exit 1
+  $shadercross_compute -DSORT_COUNT_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_count.comp.spv || exit 1
+  $shadercross_compute -DSORT_SCAN_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_scan.comp.spv || exit 1
+  $shadercross_compute -DSORT_SCATTER_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_scatter.comp.spv || exit 1
 
   $shadercross_vertex -DPRIMITIVE_KIND_POINTS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_points.vert.msl || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_POINTS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_points.frag.msl || exit 1
   $shadercross_vertex -DPRIMITIVE_KIND_LINES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_lines.vert.msl || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_LINES -DMESH_INSTANCES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_mesh_lines.vert.msl || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_LINES -DPARAMETRIC_SHAPES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_shapes.vert.msl || exit 1
+  $shadercross_vertex -DSHAPE_IMPOSTORS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_impostors.vert.msl || exit 1
+  $shadercross_fragment -DSHAPE_IMPOSTORS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_impostors.frag.msl || exit 1
+  $shadercross_vertex -DOVERLAY_COMPOSITE ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_overlay.vert.msl || exit 1
+  $shadercross_fragment -DOVERLAY_COMPOSITE ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_overlay.frag.msl || exit 1
+  $shadercross_vertex -DTEXT_GLYPHS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_text.vert.msl || exit 1
+  $shadercross_fragment -DTEXT_GLYPHS ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_text.frag.msl || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_LINES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_lines.frag.msl || exit 1
   $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_triangles.vert.msl || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES -DINDEXED_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_indexed_triangles.vert.msl || exit 1
+  $shadercross_vertex -DPRIMITIVE_KIND_TRIANGLES -DMESH_INSTANCES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_mesh_triangles.vert.msl || exit 1
   $shadercross_fragment -DPRIMITIVE_KIND_TRIANGLES ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_triangles.frag.msl || exit 1
+  $shadercross_compute -DCULL_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_cull.comp.msl || exit 1
+  $shadercross_compute -DSORT_KEYS_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_keys.comp.msl || exit 1
+  $shadercross_compute -DSORT_COUNT_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_count.comp.msl || exit 1
+  $shadercross_compute -DSORT_SCAN_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_scan.comp.msl || exit 1
+  $shadercross_compute -DSORT_SCATTER_SHADER ../src/im3d_sdl3_gpu.hlsl -o .shaders/im3d_sort_scatter.comp.msl || exit 1
 
   echo "Compiling shaders_to_c_arrays..."
   $cc_compile ../src/shaders_to_c_arrays.cpp -DOUT_DIR="\"${source_dir}/src\"" -o shaders_to_c_arrays || exit 1
 
   echo "Exporting shaders to C arrays..."
-  ./shaders_to_c_arrays || exit 1
+  ./shaders_to_c_arrays --compress || exit 1
 fi
 
 echo "Compiling example..."
@@ -133,4 +183,18 @@ if [ ! -f "$build_dir/libSDL3.so.0" ]; then
   cp -t "$build_dir/" extern/SDL3/linux/lib/libSDL3.so.0* 2>/dev/null || true
 fi
 
+# --- Run Tests --------------------------------------------------------------
+if [ $tests -eq 1 ]; then
+  pushd "$build_dir" >/dev/null
+  echo "Compiling tests..."
+  $cc_example_compile \
+    ../tests/im3d_sdl3_gpu_tests.cpp \
+    ../extern/im3d/im3d.cpp \
+    $cc_example_link -o im3d_sdl3_gpu_tests || exit 1
+
+  echo "Running tests..."
+  ./im3d_sdl3_gpu_tests || exit 1
+  popd >/dev/null
+fi
+
 echo "Done!"
@@ -84,11 +84,15 @@ using namespace Im3d;
 
 constexpr Color Color_GizmoHighlight = Im3d::Color_Gold;
 
+// Strips add a vertex per primitive (plus 1 or 2 per strip), they are never sorted by Context::sort().
 static const int VertsPerDrawPrimitive[DrawPrimitive_Count] =
 {
 	3, //DrawPrimitive_Triangles,
 	2, //DrawPrimitive_Lines,
-	1  //DrawPrimitive_Points,
+	1, //DrawPrimitive_Points,
+	1, //DrawPrimitive_TriangleStrip,
+	3, //DrawPrimitive_IndexedTriangles, per index
+	1  //DrawPrimitive_LineStrip,
 };
 
 Color::Color(const Vec4& _rgba)
@@ -200,13 +204,13 @@ void Im3d::DrawQuad(const Vec3& _origin, const Vec3& _normal, const Vec2& _size)
 void Im3d::DrawQuadFilled(const Vec3& _a, const Vec3& _b, const Vec3& _c, const Vec3& _d)
 {
 	Context& ctx = GetContext();
-	ctx.begin(PrimitiveMode_Triangles);
+	ctx.begin(PrimitiveMode_IndexedTriangles);
 		ctx.vertex(_a);
 		ctx.vertex(_b);
 		ctx.vertex(_c);
-		ctx.vertex(_a);
-		ctx.vertex(_c);
 		ctx.vertex(_d);
+		ctx.index(0); ctx.index(1); ctx.index(2);
+		ctx.index(0); ctx.index(2); ctx.index(3);
 	ctx.end();
 }
 void Im3d::DrawQuadFilled(const Vec3& _origin, const Vec3& _normal, const Vec2& _size)
@@ -265,19 +269,18 @@ void Im3d::DrawCircleFilled(const Vec3& _origin, const Vec3& _normal, float _rad
 	_detail = Max(_detail, 3);
 
  	ctx.pushMatrix(ctx.getMatrix() * LookAt(_origin, _origin + _normal, ctx.getAppData().m_worldUp));
-	ctx.begin(PrimitiveMode_Triangles);
-		float cp = _radius;
-		float sp = 0.0f;
-		for (int i = 1; i <= _detail; ++i)
+	ctx.begin(PrimitiveMode_IndexedTriangles);
+		ctx.vertex(Vec3(0.0f, 0.0f, 0.0f));
+		for (int i = 0; i < _detail; ++i)
 		{
-			ctx.vertex(Vec3(0.0f, 0.0f, 0.0f));
-			ctx.vertex(Vec3(cp, sp, 0.0f));
 			float rad = TwoPi * ((float)i / (float)_detail);
-			float c = cosf(rad) * _radius;
-			float s = sinf(rad) * _radius;
-			ctx.vertex(Vec3(c, s, 0.0f));
-			cp = c;
-			sp = s;
+			ctx.vertex(Vec3(cosf(rad) * _radius, sinf(rad) * _radius, 0.0f));
+		}
+		for (int i = 0; i < _detail; ++i)
+		{
+			ctx.index(0);
+			ctx.index(1 + i);
+			ctx.index(1 + (i + 1) % _detail);
 		}
 	ctx.end();
 	ctx.popMatrix();
@@ -323,6 +326,19 @@ void Im3d::DrawSphere(const Vec3& _origin, float _radius, int _detail)
 		}
 	ctx.end();
 }
+// Vertex index of _column on _ring for DrawSphereFilled(), ring 0 and _ringCount are the poles.
+static U32 SphereVertexIndex(int _ring, int _column, int _ringCount, int _detail)
+{
+	if (_ring == 0)
+	{
+		return 0;
+	}
+	if (_ring == _ringCount)
+	{
+		return 1;
+	}
+	return 2 + (_ring - 1) * _detail + _column % _detail;
+}
 void Im3d::DrawSphereFilled(const Vec3& _origin, float _radius, int _detail)
 {
 	Context& ctx = GetContext();
@@ -339,37 +355,41 @@ void Im3d::DrawSphereFilled(const Vec3& _origin, float _radius, int _detail)
 	}
 	_detail = Max(_detail, 6);
 
-	ctx.begin(PrimitiveMode_Triangles);
-		float yp = -_radius;
-		float rp = 0.0f;
-		for (int i = 1; i <= _detail / 2; ++i)
+	const int rings = _detail / 2;
+	ctx.begin(PrimitiveMode_IndexedTriangles);
+	 // the poles, followed by _detail vertices for each ring in between
+		ctx.vertex(Vec3(_origin.x, _origin.y - _radius, _origin.z));
+		ctx.vertex(Vec3(_origin.x, _origin.y + _radius, _origin.z));
+		for (int i = 1; i < rings; ++i)
 		{
-			float y = ((float)i / (float)(_detail / 2)) * 2.0f - 1.0f;
+			float y = ((float)i / (float)rings) * 2.0f - 1.0f;
 			float r = cosf(y * HalfPi) * _radius;
 			y = sinf(y * HalfPi) * _radius;
-
-			float xp = 1.0f;
-			float zp = 0.0f;
-			for (int j = 1; j <= _detail; ++j)
+			for (int j = 0; j < _detail; ++j)
 			{
 				float x = ((float)j / (float)(_detail)) * TwoPi;
-				float z = sinf(x);
-				x = cosf(x);
-
-				ctx.vertex(Vec3(xp * rp + _origin.x, yp + _origin.y, zp * rp + _origin.z));
-				ctx.vertex(Vec3(xp * r  + _origin.x, y  + _origin.y, zp * r  + _origin.z));
-				ctx.vertex(Vec3(x  * r  + _origin.x, y  + _origin.y, z  * r  + _origin.z));
-
-				ctx.vertex(Vec3(xp * rp + _origin.x, yp + _origin.y, zp * rp + _origin.z));
-				ctx.vertex(Vec3(x  * r  + _origin.x, y  + _origin.y, z  * r  + _origin.z));
-				ctx.vertex(Vec3(x  * rp + _origin.x, yp + _origin.y, z  * rp + _origin.z));
-
-				xp = x;
-				zp = z;
+				ctx.vertex(Vec3(cosf(x) * r + _origin.x, y + _origin.y, sinf(x) * r + _origin.z));
 			}
+		}
 
-			yp = y;
-			rp = r;
+	 // a quad between each pair of rings, the triangles which would be degenerate at the poles are skipped
+		for (int i = 1; i <= rings; ++i)
+		{
+			for (int j = 1; j <= _detail; ++j)
+			{
+				U32 a = SphereVertexIndex(i - 1, j - 1, rings, _detail);
+				U32 b = SphereVertexIndex(i,     j - 1, rings, _detail);
+				U32 c = SphereVertexIndex(i,     j,     rings, _detail);
+				U32 d = SphereVertexIndex(i - 1, j,     rings, _detail);
+				if (i < rings)
+				{
+					ctx.index(a); ctx.index(b); ctx.index(c);
+				}
+				if (i > 1)
+				{
+					ctx.index(a); ctx.index(c); ctx.index(d);
+				}
+			}
 		}
 	ctx.end();
 }
@@ -668,40 +688,36 @@ void Im3d::DrawConeFilled2(const Vec3& _start, const Vec3& _end, float _radiusSt
 	ctx.pushEnableSorting(true);
 
 	
-	// Start cap.
-	if (_drawCapStart && _radiusStart > 0.0f)
-	{
-		ctx.begin(PrimitiveMode_TriangleStrip);
-			for (int i = 0; i <= _detail; ++i)
-			{
-				const float rad = TwoPi * ((float)i / (float)_detail) - HalfPi;
-				ctx.vertex(Vec3(0.0f, 0.0f, -ln) + Vec3(cosf(rad), sinf(rad), 0.0f) * _radiusStart);
-				ctx.vertex(Vec3(0.0f, 0.0f, -ln));
-			}
-		ctx.end();
-	}
-
-	// End cap.
-	if (_drawCapEnd && _radiusEnd > 0.0f)
-	{
-		ctx.begin(PrimitiveMode_TriangleStrip);
-			for (int i = 0; i <= _detail; ++i)
-			{
-				const float rad = TwoPi * ((float)i / (float)_detail) - HalfPi;
-				ctx.vertex(Vec3(0.0f, 0.0f, ln) + Vec3(cosf(rad), sinf(rad), 0.0f) * _radiusEnd);
-				ctx.vertex(Vec3(0.0f, 0.0f, ln));
-			}
-		ctx.end();
-	}
-
-	// Sides.
-	ctx.begin(PrimitiveMode_TriangleStrip);
-		for (int i = 0; i <= _detail; ++i)
+	// Sides, a start and an end vertex per step around the axis followed by the cap centers.
+	ctx.begin(PrimitiveMode_IndexedTriangles);
+		for (int i = 0; i < _detail; ++i)
 		{
 			const float rad = TwoPi * ((float)i / (float)_detail) - HalfPi;
 			ctx.vertex(Vec3(0.0f, 0.0f, -ln) + Vec3(cosf(rad), sinf(rad), 0.0f) * _radiusStart);
 			ctx.vertex(Vec3(0.0f, 0.0f,  ln) + Vec3(cosf(rad), sinf(rad), 0.0f) * _radiusEnd);
 		}
+		ctx.vertex(Vec3(0.0f, 0.0f, -ln));
+		ctx.vertex(Vec3(0.0f, 0.0f,  ln));
+
+		const U32 centerStart = 2 * _detail;
+		const U32 centerEnd   = 2 * _detail + 1;
+		for (int i = 0; i < _detail; ++i)
+		{
+			const U32 start     = 2 * i;
+			const U32 end       = 2 * i + 1;
+			const U32 nextStart = 2 * ((i + 1) % _detail);
+			const U32 nextEnd   = nextStart + 1;
+			ctx.index(start); ctx.index(end); ctx.index(nextStart);
+			ctx.index(end); ctx.index(nextStart); ctx.index(nextEnd);
+			if (_drawCapStart && _radiusStart > 0.0f)
+			{
+				ctx.index(start); ctx.index(centerStart); ctx.index(nextStart);
+			}
+			if (_drawCapEnd && _radiusEnd > 0.0f)
+			{
+				ctx.index(end); ctx.index(centerEnd); ctx.index(nextEnd);
+			}
+		}
 	ctx.end();
 
 	ctx.popEnableSorting();
@@ -770,19 +786,18 @@ void Im3d::DrawConeFilled(const Vec3& _origin, const Vec3& _normal, float height
 
     //cone side face
     ctx.pushMatrix(ctx.getMatrix() * LookAt(_origin, _origin + _normal, ctx.getAppData().m_worldUp));
-    ctx.begin(PrimitiveMode_Triangles);
-        float cp = _radius;
-        float sp = 0.0f;
-        for (int i = 1; i <= _detail; ++i)
+    ctx.begin(PrimitiveMode_IndexedTriangles);
+        ctx.vertex(Vec3(0,0,1)*height);
+        for (int i = 0; i < _detail; ++i)
         {
-            ctx.vertex(Vec3(0,0,1)*height);
-            ctx.vertex(Vec3(cp, sp, 0.0f));
             float rad = TwoPi * ((float)i / (float)_detail);
-            float c = cosf(rad) * _radius;
-            float s = sinf(rad) * _radius;
-            ctx.vertex(Vec3(c, s, 0.0f));
-            cp = c;
-            sp = s;
+            ctx.vertex(Vec3(cosf(rad) * _radius, sinf(rad) * _radius, 0.0f));
+        }
+        for (int i = 0; i < _detail; ++i)
+        {
+            ctx.index(0);
+            ctx.index(1 + i);
+            ctx.index(1 + (i + 1) % _detail);
         }
     ctx.end();
     ctx.popMatrix();
@@ -1513,7 +1528,7 @@ static void AlignedFree(void* _ptr_)
 template <typename T>
 Vector<T>::~Vector()
 {
-	if (m_data)
+	if (m_data && !m_external)
 	{
 		AlignedFree(m_data);
 		m_data = 0;
@@ -1545,10 +1560,14 @@ void Vector<T>::reserve(U32 _capacity)
 	if (m_data)
 	{
 		memcpy(data, m_data, sizeof(T) * m_size);
-		AlignedFree(m_data);;
+		if (!m_external)
+		{
+			AlignedFree(m_data);
+		}
 	}
 	m_data = data;
 	m_capacity = _capacity;
+	m_external = false;
 }
 
 template <typename T>
@@ -1583,6 +1602,39 @@ void Vector<T>::swap(Vector<T>& _a_, Vector<T>& _b_)
 	_b_.m_data     = data;
 	_b_.m_capacity = capacity;
 	_b_.m_size     = size;
+	bool external  = _a_.m_external;
+	_a_.m_external = _b_.m_external;
+	_b_.m_external = external;
+}
+
+template <typename T>
+void Vector<T>::setExternal(T* _data, U32 _capacity)
+{
+	IM3D_ASSERT(_data && _capacity > 0);
+	IM3D_ASSERT(m_size <= _capacity);
+	if (m_data)
+	{
+		memcpy(_data, m_data, sizeof(T) * m_size);
+		if (!m_external)
+		{
+			AlignedFree(m_data);
+		}
+	}
+	m_data = _data;
+	m_capacity = _capacity;
+	m_external = true;
+}
+
+template <typename T>
+void Vector<T>::resetExternal()
+{
+	if (m_external)
+	{
+		m_data = nullptr;
+		m_capacity = 0;
+		m_external = false;
+	}
+	m_size = 0;
 }
 
 template struct Im3d::Vector<bool>;
@@ -1608,24 +1660,35 @@ void Context::begin(PrimitiveMode _mode)
 	IM3D_ASSERT(m_primMode == PrimitiveMode_None); // forgot to call End()
 	m_primMode = _mode;
 	m_vertCountThisPrim = 0;
+	const bool nativeStrip = m_nativeStrips && (m_vertexDataIndex == 0 || m_sortingDeferred);
 	switch (m_primMode)
 	{
 		case PrimitiveMode_Points:
 			m_primType = DrawPrimitive_Points;
 			break;
 		case PrimitiveMode_Lines:
+			m_primType = DrawPrimitive_Lines;
+			break;
 		case PrimitiveMode_LineStrip:
 		case PrimitiveMode_LineLoop:
-			m_primType = DrawPrimitive_Lines;
+			m_primType = nativeStrip ? DrawPrimitive_LineStrip : DrawPrimitive_Lines;
 			break;
 		case PrimitiveMode_Triangles:
-		case PrimitiveMode_TriangleStrip:
 			m_primType = DrawPrimitive_Triangles;
 			break;
+		case PrimitiveMode_TriangleStrip:
+			m_primType = nativeStrip ? DrawPrimitive_TriangleStrip : DrawPrimitive_Triangles;
+			break;
+		case PrimitiveMode_IndexedTriangles:
+		 // indexed triangles are expanded when sorted, sort() reorders whole triangles
+			m_primType = m_nativeIndices && m_vertexDataIndex == 0 ? DrawPrimitive_IndexedTriangles : DrawPrimitive_Triangles;
+			m_indexedVertices.clear();
+			break;
 		default:
 			break;
 	};
 	m_firstVertThisPrim = getCurrentVertexList()->size();
+	m_firstIndexThisPrim = m_indexData[m_layerIndex]->size();
 }
 
 void Context::end()
@@ -1646,8 +1709,18 @@ void Context::end()
 				break;
 			case PrimitiveMode_LineLoop:
 				IM3D_ASSERT(m_vertCountThisPrim > 1);
-				vertexList->push_back(vertexList->back());
-				vertexList->push_back((*vertexList)[m_firstVertThisPrim]);
+			 // the list may live in write-combined memory (see setVertexArena()), so the loop is closed
+			 // with vertex copies kept in the context rather than read back from it
+				if (m_primType == DrawPrimitive_LineStrip)
+				{
+				 // close the loop with a copy of the first vertex which doesn't start a strip
+					vertexList->push_back(m_firstVertDataThisPrim);
+				}
+				else
+				{
+					vertexList->push_back(m_lastVertDataThisPrim[1]);
+					vertexList->push_back(m_firstVertDataThisPrim);
+				}
 				break;
 			case PrimitiveMode_Triangles:
 				IM3D_ASSERT(m_vertCountThisPrim % 3 == 0);
@@ -1655,6 +1728,10 @@ void Context::end()
 			case PrimitiveMode_TriangleStrip:
 				IM3D_ASSERT(m_vertCountThisPrim >= 3);
 				break;
+			case PrimitiveMode_IndexedTriangles:
+				IM3D_ASSERT(m_primType != DrawPrimitive_IndexedTriangles || (m_indexData[m_layerIndex]->size() - m_firstIndexThisPrim) % 3 == 0);
+				IM3D_ASSERT(m_primType != DrawPrimitive_Triangles || (vertexList->size() - m_firstVertThisPrim) % 3 == 0);
+				break;
 			default:
 				break;
 		};
@@ -1664,7 +1741,8 @@ void Context::end()
 			m_maxVertThisPrim = m_maxVertThisPrim + Vec3(1.0f);
 			if (!isVisible(m_minVertThisPrim, m_maxVertThisPrim))
 			{
-				vertexList->resize(m_firstVertThisPrim, VertexData());
+				vertexList->resize(m_firstVertThisPrim);
+				m_indexData[m_layerIndex]->resize(m_firstIndexThisPrim, 0);
 			}
 		#endif
 	}
@@ -1712,6 +1790,18 @@ void Context::vertex(const Vec3& _position, float _size, Color _color)
 	#endif
 
 	VertexList* vertexList = getCurrentVertexList();
+	if (m_vertCountThisPrim == 0)
+	{
+		m_firstVertDataThisPrim = vd;
+	}
+	if (m_primType == DrawPrimitive_LineStrip || m_primType == DrawPrimitive_TriangleStrip)
+	{
+	 // native strip, the sign bit of the size marks the first vertex
+		vd.m_positionSize.w = m_vertCountThisPrim == 0 ? -fabs(_size) : fabs(_size);
+		vertexList->push_back(vd);
+		++m_vertCountThisPrim;
+		return;
+	}
 	switch (m_primMode)
 	{
 		case PrimitiveMode_Points:
@@ -1723,7 +1813,7 @@ void Context::vertex(const Vec3& _position, float _size, Color _color)
 		case PrimitiveMode_LineLoop:
 			if (m_vertCountThisPrim >= 2)
 			{
-				vertexList->push_back(vertexList->back());
+				vertexList->push_back(m_lastVertDataThisPrim[1]);
 				++m_vertCountThisPrim;
 			}
 			vertexList->push_back(vd);
@@ -1731,16 +1821,28 @@ void Context::vertex(const Vec3& _position, float _size, Color _color)
 		case PrimitiveMode_TriangleStrip:
 			if (m_vertCountThisPrim >= 3)
 			{
-				vertexList->push_back(*(vertexList->end() - 2));
-				vertexList->push_back(*(vertexList->end() - 2));
+				vertexList->push_back(m_lastVertDataThisPrim[0]);
+				vertexList->push_back(m_lastVertDataThisPrim[1]);
 				m_vertCountThisPrim += 2;
 			}
 			vertexList->push_back(vd);
 			break;
+		case PrimitiveMode_IndexedTriangles:
+			if (m_primType == DrawPrimitive_IndexedTriangles)
+			{
+				vertexList->push_back(vd);
+			}
+			else
+			{
+				m_indexedVertices.push_back(vd); // expanded by index()
+			}
+			break;
 		default:
 			break;
 	};
 	++m_vertCountThisPrim;
+	m_lastVertDataThisPrim[0] = m_lastVertDataThisPrim[1];
+	m_lastVertDataThisPrim[1] = vd;
 
 	#if 0
 	 // per-vertex primitive culling; this method is generally too expensive to be practical (and can't cull line loops).
@@ -1791,6 +1893,21 @@ void Context::vertex(const Vec3& _position, float _size, Color _color)
 	#endif
 }
 
+void Context::index(U32 _index)
+{
+	IM3D_ASSERT(m_primMode == PrimitiveMode_IndexedTriangles); // Index() called without BeginIndexedTriangles()
+	IM3D_ASSERT(_index < m_vertCountThisPrim); // Index() must refer to a vertex of the current primitive
+
+	if (m_primType == DrawPrimitive_IndexedTriangles)
+	{
+		m_indexData[m_layerIndex]->push_back(m_firstVertThisPrim + _index);
+	}
+	else
+	{
+		getCurrentVertexList()->push_back(m_indexedVertices[_index]);
+	}
+}
+
 void Context::text(const Vec3& _position, float _size, Color _color, TextFlags _flags, const char* _textStart, const char* _textEnd)
 {
 	TextData& td = getCurrentTextList()->push_back();
@@ -1851,12 +1968,33 @@ void Context::reset()
 	m_primType = DrawPrimitive_Count;
 
 	IM3D_ASSERT(m_vertexData[0].size() == m_vertexData[1].size());
+	U32 arenaOffset = 0;
 	for (U32 i = 0; i < m_vertexData[0].size(); ++i)
 	{
-		m_vertexData[0][i]->clear();
+		VertexList* vertexList = m_vertexData[0][i];
+		U32 prevSize = vertexList->size();
+		vertexList->resetExternal();
+		if (m_vertexArena && prevSize > 0)
+		{
+			// Headroom so that small frame-to-frame variations stay in the arena.
+			U32 sliceSize = prevSize + prevSize / 2;
+			sliceSize = sliceSize < 64 ? 64 : sliceSize;
+			if (arenaOffset + sliceSize <= m_vertexArenaCapacity)
+			{
+				vertexList->setExternal(m_vertexArena + arenaOffset, sliceSize);
+				arenaOffset += sliceSize;
+			}
+		}
 		m_vertexData[1][i]->clear();
 	}
+	m_vertexArena = nullptr;
+	m_vertexArenaCapacity = 0;
 	m_drawLists.clear();
+	m_unsortedDrawListCount = 0;
+	for (U32 i = 0; i < m_indexData.size(); ++i)
+	{
+		m_indexData[i]->clear();
+	}
 	for (U32 i = 0; i < m_textData.size(); ++i)
 	{
 		m_textData[i]->clear();
@@ -1936,7 +2074,18 @@ void Context::merge(const Context& _src)
 			const int layerIndex = findLayerIndex(layerId);
 			IM3D_ASSERT(layerIndex >= 0);
 			U32 k = j % DrawPrimitive_Count;
-			m_vertexData[i][layerIndex * DrawPrimitive_Count + k]->append(*vertexData[j]);
+			VertexList* dstList = m_vertexData[i][layerIndex * DrawPrimitive_Count + k];
+			if (i == 0 && k == DrawPrimitive_IndexedTriangles)
+			{
+			 // indices are relative to the start of the vertex list
+				const IndexList& srcIndices = *_src.m_indexData[j / DrawPrimitive_Count];
+				IndexList& dstIndices = *m_indexData[layerIndex];
+				for (U32 index : srcIndices)
+				{
+					dstIndices.push_back(dstList->size() + index);
+				}
+			}
+			dstList->append(*vertexData[j]);
 		}
 	}
 
@@ -1973,13 +2122,41 @@ void Context::endFrame()
 			dl.m_primType    = (DrawPrimitiveType)(i % DrawPrimitive_Count);
 			dl.m_vertexData  = m_vertexData[0][i]->data();
 			dl.m_vertexCount = m_vertexData[0][i]->size();
+			dl.m_indexData   = nullptr;
+			dl.m_indexCount  = 0;
+			if (dl.m_primType == DrawPrimitive_IndexedTriangles)
+			{
+				dl.m_indexData  = m_indexData[i / DrawPrimitive_Count]->data();
+				dl.m_indexCount = m_indexData[i / DrawPrimitive_Count]->size();
+			}
 		}
 	}
 
  // draw sorted primitives second
+	m_unsortedDrawListCount = m_drawLists.size();
 	if (!m_sortCalled)
 	{
-		sort();
+		if (m_sortingDeferred)
+		{
+			for (U32 i = 0; i < m_vertexData[1].size(); ++i)
+			{
+				if (m_vertexData[1][i]->size() > 0)
+				{
+					DrawList& dl     = m_drawLists.push_back();
+					dl.m_layerId     = m_layerIdMap[i / DrawPrimitive_Count];
+					dl.m_primType    = (DrawPrimitiveType)(i % DrawPrimitive_Count);
+					dl.m_vertexData  = m_vertexData[1][i]->data();
+					dl.m_vertexCount = m_vertexData[1][i]->size();
+					dl.m_indexData   = nullptr;
+					dl.m_indexCount  = 0;
+				}
+			}
+			m_sortCalled = true;
+		}
+		else
+		{
+			sort();
+		}
 	}
 
 	for (U32 i = 0; i < m_textData.size(); ++i) {
@@ -2042,6 +2219,8 @@ void Context::pushLayerId(Id _layer)
 			m_vertexData[1].push_back((VertexList*)IM3D_MALLOC(sizeof(VertexList)));
 			*m_vertexData[1].back() = VertexList();
 		}
+		m_indexData.push_back((IndexList*)IM3D_MALLOC(sizeof(IndexList)));
+		*m_indexData.back() = IndexList();
 		m_textData.push_back((TextList*)IM3D_MALLOC(sizeof(TextList)));
 		*m_textData.back() = TextList();
 	}
@@ -2058,7 +2237,13 @@ void Context::popLayerId()
 Context::Context()
 {
 	m_sortCalled = false;
+	m_sortingDeferred = false;
+	m_nativeStrips = false;
+	m_nativeIndices = false;
 	m_endFrameCalled = false;
+	m_vertexArena = nullptr;
+	m_vertexArenaCapacity = 0;
+	m_unsortedDrawListCount = 0;
 	m_primMode = PrimitiveMode_None;
 	m_vertexDataIndex = 0; // = sorting disabled
 	m_layerIndex = 0;
@@ -2106,6 +2291,13 @@ Context::~Context()
 		}
 	}
 
+	while (!m_indexData.empty())
+	{
+		m_indexData.back()->~Vector(); // see above
+		IM3D_FREE(m_indexData.back());
+		m_indexData.pop_back();
+	}
+
 	while (!m_textData.empty())
 	{
 		m_textData.back()->~Vector(); // see above
@@ -2239,6 +2431,8 @@ void Context::sort()
 				dl.m_primType    = (DrawPrimitiveType)cprim;
 				dl.m_vertexData  = m_vertexData[1][layer * DrawPrimitive_Count + cprim]->data() + (search[cprim] - sortData[cprim].data()) * VertsPerDrawPrimitive[cprim];
 				dl.m_vertexCount = 0;
+				dl.m_indexData   = nullptr;
+				dl.m_indexCount  = 0;
 				m_drawLists.push_back(dl);
 				first = false;
 			}
@@ -2926,6 +3120,11 @@ U32 Context::getPrimitiveCount(DrawPrimitiveType _type) const
 	for (U32 i = 0; i < m_layerIdMap.size(); ++i)
 	{
 		U32 j = i * DrawPrimitive_Count + _type;
+		if (_type == DrawPrimitive_IndexedTriangles)
+		{
+			ret += m_indexData[i]->size();
+			continue;
+		}
 		ret += m_vertexData[0][j]->size() + m_vertexData[1][j]->size();
 	}
 	ret /= VertsPerDrawPrimitive[_type];
@@ -452,16 +452,24 @@ enum DrawPrimitiveType
 	DrawPrimitive_Triangles,
 	DrawPrimitive_Lines,
 	DrawPrimitive_Points,
+ // the native types follow the upstream ones so that those keep their values
+	DrawPrimitive_TriangleStrip,    // Only with Context::setNativeStrips(), see below.
+	DrawPrimitive_IndexedTriangles, // Only with Context::setNativeIndices().
+	DrawPrimitive_LineStrip,        // Only with Context::setNativeStrips().
 
 	DrawPrimitive_Count
 };
 
+// Strip draw lists hold each strip's vertices once. The first vertex of each strip has the sign bit of its size set, every
+// primitive is formed from consecutive vertices (2 for lines, 3 for triangles) which don't cross the start of a strip.
 struct DrawList
 {
 	Id                m_layerId;
 	DrawPrimitiveType m_primType;
 	const VertexData* m_vertexData;
 	U32               m_vertexCount;
+	const U32*        m_indexData;   // DrawPrimitive_IndexedTriangles only, 3 per triangle, relative to m_vertexData.
+	U32               m_indexCount;
 };
 typedef void (DrawPrimitivesCallback)(const DrawList& _drawList);
 
@@ -588,11 +596,18 @@ struct Vector
 
 	static void swap(Vector<T>& _a_, Vector<T>& _b_);
 
+	// Use _data (not owned by the vector) as storage for up to _capacity elements. Growing beyond _capacity moves the data to owned memory.
+	void        setExternal(T* _data, U32 _capacity);
+	// Drop external storage without touching it (it may no longer be accessible), leaving the vector empty.
+	void        resetExternal();
+	bool        isExternal() const                   { return m_external; }
+
 private:
 
 	T*   m_data     = nullptr;
 	U32  m_size     = 0;
 	U32  m_capacity = 0;
+	bool m_external = false;
 };
 
 
@@ -604,7 +619,8 @@ enum PrimitiveMode
 	PrimitiveMode_LineStrip,
 	PrimitiveMode_LineLoop,
 	PrimitiveMode_Triangles,
-	PrimitiveMode_TriangleStrip
+	PrimitiveMode_TriangleStrip,
+	PrimitiveMode_IndexedTriangles // Vertices followed by Index() calls, 3 per triangle and relative to the first vertex.
 };
 enum GizmoMode
 {
@@ -624,6 +640,7 @@ struct IM3D_API Context
 
 	void                vertex(const Vec3& _position, float _size, Color _color);
 	void                vertex(const Vec3& _position )   { vertex(_position, getSize(), getColor()); }
+	void                index(U32 _index);
 
 	void                text(const Vec3& _position, float _size, Color _color, TextFlags _flags, const char* _textStart, const char* _textEnd);
 	void                text(const Vec3& _position, float _size, Color _color, TextFlags _flags, const char* _text, va_list _args);
@@ -635,6 +652,7 @@ struct IM3D_API Context
 
 	const DrawList*     getDrawLists() const             { return m_drawLists.data(); }
 	U32                 getDrawListCount() const         { return m_drawLists.size(); }
+	U32                 getUnsortedDrawListCount() const { return m_unsortedDrawListCount; } // Draw lists before this index contain unsorted primitives.
 
 	const TextDrawList* getTextDrawLists() const         { return m_textDrawLists.data();  }
 	U32                 getTextDrawListCount() const     { return m_textDrawLists.size();  }
@@ -677,6 +695,25 @@ struct IM3D_API Context
 
 	AppData&            getAppData()                     { return m_appData; }
 
+	// Provide memory for the unsorted vertex lists of the next frame (e.g. a mapped GPU upload buffer), call before reset().
+	// Each list which was non-empty in the previous frame receives a slice sized from its previous vertex count; lists which
+	// outgrow their slice (or receive none) fall back to heap memory. The memory must remain valid until the next reset().
+	void                setVertexArena(VertexData* _data, U32 _capacity) { m_vertexArena = _data; m_vertexArenaCapacity = _capacity; }
+
+	// Skip sort() in endFrame(); sorted primitives are emitted in push order as one draw list per layer and primitive type, after
+	// the unsorted draw lists, and the app is responsible for sorting them (e.g. on the GPU).
+	void                setSortingDeferred(bool _deferred) { m_sortingDeferred = _deferred; }
+	bool                getSortingDeferred() const         { return m_sortingDeferred; }
+
+	// Store line strips/loops and triangle strips as DrawPrimitive_LineStrip/DrawPrimitive_TriangleStrip draw lists instead of
+	// expanding them to lines/triangles, unless they are sorted by sort().
+	void                setNativeStrips(bool _native)      { m_nativeStrips = _native; }
+	bool                getNativeStrips() const            { return m_nativeStrips; }
+
+	// Store unsorted indexed triangles as DrawPrimitive_IndexedTriangles draw lists instead of expanding them to triangles.
+	void                setNativeIndices(bool _native)     { m_nativeIndices = _native; }
+	bool                getNativeIndices() const           { return m_nativeIndices; }
+
  // Low-level interface for internal and app-defined gizmos. May be subject to breaking changes.
 
 	bool                gizmoAxisTranslation_Behavior(Id _id, const Vec3& _origin, const Vec3& _axis, float _snap, float _worldHeight, float _worldSize, Vec3* _out_);
@@ -743,6 +780,9 @@ struct IM3D_API Context
 	// Return the number of layers.
 	U32                 getLayerCount() const { return m_layerIdMap.size(); }
 
+	// Return the position of layer _id in the draw order of the unsorted draw lists, or -1 if it was never pushed.
+	int                 getLayerIndex(Id _id) const { return findLayerIndex(_id); }
+
 private:
 
  // State stacks.
@@ -761,8 +801,17 @@ private:
 	Vector<Id>          m_layerIdMap;                       // Map Id -> vertex data index.
 	int                 m_layerIndex;                       // Index of the currently active layer in m_layerIdMap.
 	Vector<DrawList>    m_drawLists;                        // All draw lists for the current frame, available after calling endFrame() before calling reset().
+	typedef Vector<U32> IndexList;
+	Vector<IndexList*>  m_indexData;                        // One list per layer for its unsorted DrawPrimitive_IndexedTriangles vertex list.
+	VertexList          m_indexedVertices;                  // Vertices of the current indexed primitive when it is expanded to triangles.
+	U32                 m_unsortedDrawListCount;            // Unsorted draw lists come first in m_drawLists.
 	bool                m_sortCalled;                       // Avoid calling sort() during every call to draw().
+	bool                m_sortingDeferred;                  // Sorted primitives are left for the app to sort, see setSortingDeferred().
+	bool                m_nativeStrips;                     // See setNativeStrips().
+	bool                m_nativeIndices;                    // See setNativeIndices().
 	bool                m_endFrameCalled;                   // For assert, if vertices are pushed after endFrame() was called.
+	VertexData*         m_vertexArena;                      // App-provided storage for unsorted vertex lists, consumed by reset().
+	U32                 m_vertexArenaCapacity;              //               "
 
  // Text data: one list per layer.
 	typedef Vector<TextData> TextList;
@@ -774,7 +823,10 @@ private:
 	PrimitiveMode       m_primMode;
 	DrawPrimitiveType   m_primType;
 	U32                 m_firstVertThisPrim;                // Index of the first vertex pushed during this primitive.
+	U32                 m_firstIndexThisPrim;               // Index of the first index pushed during this primitive.
 	U32                 m_vertCountThisPrim;                // # calls to vertex() since the last call to begin().
+	VertexData          m_firstVertDataThisPrim;            // First vertex passed to vertex() during this primitive.
+	VertexData          m_lastVertDataThisPrim[2];          // Last 2 vertices pushed during this primitive, strips and loops repeat them.
 	Vec3                m_minVertThisPrim;
 	Vec3                m_maxVertThisPrim;
 
@@ -825,6 +877,7 @@ inline void                BeginLineLoop()
 inline void                BeginLineStrip()                                                                                 { GetContext().begin(PrimitiveMode_LineStrip); }
 inline void                BeginTriangles()                                                                                 { GetContext().begin(PrimitiveMode_Triangles); }
 inline void                BeginTriangleStrip()                                                                             { GetContext().begin(PrimitiveMode_TriangleStrip); }
+inline void                BeginIndexedTriangles()                                                                          { GetContext().begin(PrimitiveMode_IndexedTriangles); }
 inline void                End()                                                                                            { GetContext().end(); }
 
 inline void                Vertex(const Vec3& _position)                                                                    { GetContext().vertex(_position, GetContext().getSize(), GetContext().getColor()); }
@@ -835,6 +888,7 @@ inline void                Vertex(float _x, float _y, float _z)
 inline void                Vertex(float _x, float _y, float _z, Color _color)                                               { Vertex(Vec3(_x, _y, _z), _color); }
 inline void                Vertex(float _x, float _y, float _z, float _size)                                                { Vertex(Vec3(_x, _y, _z), _size); }
 inline void                Vertex(float _x, float _y, float _z, float _size, Color _color)                                  { Vertex(Vec3(_x, _y, _z), _size, _color); }
+inline void                Index(U32 _index)                                                                                { GetContext().index(_index); }
 
 inline void                PushDrawState()                                                                                  { Context& ctx = GetContext(); ctx.pushColor(ctx.getColor()); ctx.pushAlpha(ctx.getAlpha()); ctx.pushSize(ctx.getSize()); ctx.pushEnableSorting(ctx.getEnableSorting()); }
 inline void                PopDrawState()                                                                                   { Context& ctx = GetContext(); ctx.popColor(); ctx.popAlpha(); ctx.popSize(); ctx.popEnableSorting(); }
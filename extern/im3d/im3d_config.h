@@ -32,7 +32,7 @@
 #define IM3D_CULL_GIZMOS 1
 
 // Set a layer ID for all gizmos to use internally.
-//#define IM3D_GIZMO_LAYER_ID 0xD4A1B5
+#define IM3D_GIZMO_LAYER_ID 0xD4A1B5
 
 // Conversion to/from application math types.
 #define IM3D_VEC2_APP \
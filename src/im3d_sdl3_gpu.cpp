@@ -1,303 +1,3924 @@
 #include "im3d_sdl3_gpu.h"
 #include "im3d_sdl3_gpu_shaders.h"
 #include "im3d_math.h"
+#include <SDL3/SDL_intrin.h>
 
+// Shared by the vertex and compute shaders.
 struct Vertex_Uniforms {
   Im3d::Mat4 world_to_clip_transform;
   Im3d::Vec2 resolution;
-  uint32_t   instance_offset;
+  uint32_t   segment_offset;
+  uint32_t   segment_count;
+  uint32_t   vertex_packed;
+  uint32_t   remap_offset;     // Of the batch's instance indices in the cull or sort buffer.
+  uint32_t   remap_instances;  // The instances are read through the instance indices.
+  uint32_t   primitive_vertex_count;
+  uint32_t   instance_count;
+  uint32_t   command_offset;  // Of the batch's draw command in the cull buffer, in bytes.
+  uint32_t   sort_shift;
+  uint32_t   sort_group_count;
+  Im3d::Vec3 view_origin;
+  uint32_t   sort_capacity;
+  uint32_t   sort_source_offset;  // Elements, into the sort buffer.
+  uint32_t   sort_destination_offset;
+  uint32_t   sort_count_offset;
+  uint32_t   primitive_vertex_stride;  // Less than primitive_vertex_count for strips.
+  uint32_t   mesh_instance_offset;     // Records, into the mesh instance buffer.
+  uint32_t   mesh_primitive_count;     // Drawn per mesh instance, 1 for triangle meshes.
+  uint32_t   shape_offset;             // Records, into the shape buffer.
+  uint32_t   shape_count;
+  Im3d::Mat4 clip_to_world_transform;  // Unprojects the impostor rays.
+  uint32_t   triangle_antialiasing;    // Fade triangle edges, when drawing without MSAA.
+  Im3d::Vec2 overlay_texcoord_scale;   // Of the area drawn into the overlay target.
+  uint32_t   text_offset;              // Glyph instances, into the text ring.
+  uint32_t   text_msdf;                // The font atlas is multi-channel.
 };
 
+static_assert(
+    sizeof(Im3d_SDL3_GPU_Mesh_Instance) == 64,
+    "Im3d_SDL3_GPU_Mesh_Instance must be 64 bytes");
+
+// Per draw list parameters of a batch, see find_segment in im3d_sdl3_gpu.hlsl.
+struct Draw_Segment {
+  uint32_t   first_instance;  // Relative to the batch.
+  uint32_t   vertex_offset;   // Into the vertex data buffer of the batch.
+  Im3d::Vec3 position_origin;
+  Im3d::Vec3 position_scale;
+};
+static_assert(sizeof(Draw_Segment) == 32, "Draw_Segment must be 32 bytes");
+
+// Depth test and write of a pipeline variant, see Im3d_SDL3_GPU_Depth_Mode.
+enum Depth_State {
+  DEPTH_STATE_OFF,
+  DEPTH_STATE_TEST,
+  DEPTH_STATE_TEST_WRITE,
+  DEPTH_STATE_COUNT,
+};
+
+// Each kind is created with all its depth variants the first time it is drawn with into a render
+// target configuration, see graphics_pipeline.
+enum Graphics_Pipeline_Kind {
+  GRAPHICS_PIPELINE_POINTS,
+  GRAPHICS_PIPELINE_LINES,
+  GRAPHICS_PIPELINE_TRIANGLES,
+  GRAPHICS_PIPELINE_INDEXED_TRIANGLES,
+  GRAPHICS_PIPELINE_MESH_LINES,
+  GRAPHICS_PIPELINE_MESH_TRIANGLES,
+  GRAPHICS_PIPELINE_SHAPES,
+  GRAPHICS_PIPELINE_IMPOSTORS,
+  GRAPHICS_PIPELINE_TEXT,
+  GRAPHICS_PIPELINE_OVERLAY,  // Upsamples the overlay into the render pass of render_draw_data.
+  GRAPHICS_PIPELINE_KIND_COUNT,
+};
+
+enum Compute_Pipeline_Kind {
+  COMPUTE_PIPELINE_CULL,
+  COMPUTE_PIPELINE_SORT_KEYS,
+  COMPUTE_PIPELINE_SORT_COUNT,
+  COMPUTE_PIPELINE_SORT_SCAN,
+  COMPUTE_PIPELINE_SORT_SCATTER,
+  COMPUTE_PIPELINE_KIND_COUNT,
+};
+
+// The shaders of the device's shader format, see im3d_sdl3_gpu_shaders.h.
+struct Shader_Pack {
+  const uint8_t*                    data;
+  const Im3d_SDL3_GPU_Shader_Entry* entries;  // Sorted by name.
+  uint32_t                          entry_count;
+};
+
+// A shader of the shader pack, see load_shader.
+struct Shader_Code {
+  const uint8_t* data;
+  uint32_t       size;
+  uint8_t*       unpacked;  // Owned, when the shader is stored compressed.
+};
+
+// What a graphics pipeline kind is created from, its shaders are named in the shader pack.
+struct Graphics_Pipeline_Desc {
+  const char*          name;
+  const char*          vertex_shader;
+  const char*          fragment_shader;
+  SDL_GPUPrimitiveType primitive_type;
+  bool                 vertex_input;      // Reads the quad from the vertex buffer.
+  bool                 fragment_sampler;  // Samples a texture with linear_sampler.
+};
+
+struct Compute_Pipeline_Desc {
+  const char* name;
+  const char* shader;
+  uint32_t    readonly_storage_buffer_count;
+  uint32_t    thread_count;
+};
+
+// The graphics pipelines drawing into one render target configuration, see find_target_pipelines.
+struct Target_Pipelines {
+  uint64_t                    key;  // See render_target_key.
+  Im3d_SDL3_GPU_Render_Target target;
+  SDL_GPUGraphicsPipeline*    pipelines[GRAPHICS_PIPELINE_KIND_COUNT][DEPTH_STATE_COUNT];
+  bool                        failed[GRAPHICS_PIPELINE_KIND_COUNT];
+};
+
+// Consecutive draw lists with the same primitive type, vertex data buffer and depth state, drawn
+// with a single indirect draw.
+struct Draw_Batch {
+  SDL_GPUBuffer*          vertex_data_buffer;
+  Im3d::DrawPrimitiveType prim_type;
+  Depth_State             depth_state;
+  uint32_t                first_segment;
+  uint32_t                segment_count;
+  uint32_t                instance_count;
+  uint32_t                vertex_end;      // Of the last segment, contiguous draw lists extend it.
+  bool                    sorted;          // Holds Im3d's sorted primitives, never culled.
+  bool                    culled;          // Drawn from the visible instances of the cull pass.
+  uint32_t                visible_offset;  // Into the visible instance indices of the region.
+  bool                    gpu_sorted;      // Drawn in the order of the sort passes.
+  uint32_t                sort_offset;     // Into the sort arrays of the region.
+  uint32_t                index_offset;    // Bytes, into the index buffer, for indexed triangles.
+  uint32_t                index_count;
+  bool                    index_16bit;
+};
+
+// IM3D_SDL3_GPU_VERTEX_FORMAT_PACKED vertex, see load_vertex_data in im3d_sdl3_gpu.hlsl.
+struct Packed_Vertex_Data {
+  uint32_t    position[2];  // 21:21:22 bit unorm position within the draw list bounds.
+  Im3d::Color color;
+  float       size;
+};
+static_assert(sizeof(Packed_Vertex_Data) == 16, "Packed_Vertex_Data must be 16 bytes");
+
+struct Draw_List_Info {
+  Im3d::Vec3 position_origin;
+  Im3d::Vec3 position_scale;
+  uint32_t   vertex_offset;  // Relative to the start of the data region.
+  uint32_t   vertex_count;
+  uint32_t   index_offset;   // Bytes, relative to the start of the index region.
+  uint32_t   index_count;
+  bool       index_16bit;
+  bool       index_expanded;  // Written as plain triangles, see expand_indexed_triangles.
+
+  bool retained;  // Belongs to a retained layer, see im3d_sdl3_gpu_retain_layer.
+
+  // Unchanged draw list detection, only used with cache_draw_lists.
+  Im3d::Id                layer_id;
+  Im3d::DrawPrimitiveType prim_type;
+  bool                    has_fingerprint;
+  uint64_t                fingerprint;
+  uint32_t                fingerprint_vertex_count;
+  bool                    resident;          // Drawn from the resident buffer.
+  bool                    promote;           // Moves to the resident buffer this frame.
+  uint32_t                resident_offset;   // Bytes, into the resident buffer.
+  uint32_t                ring_offset;       // Bytes, into the data buffer.
+  uint32_t                ring_vertex_count;
+  uint32_t                ring_frame;
+  uint32_t                ring_generation;
+};
+
+// A draw list captured by im3d_sdl3_gpu_retain_layer.
+struct Retained_Draw {
+  Im3d::DrawPrimitiveType prim_type;
+  uint32_t                vertex_offset;
+  uint32_t                vertex_count;
+  Im3d::Vec3              position_origin;
+  Im3d::Vec3              position_scale;
+};
+
+struct Retained_Layer {
+  Im3d::Id               layer_id;
+  int                    layer_index;  // In Im3d's layer order, updated by write_draw_batches.
+  bool                   capture_pending;
+  SDL_GPUBuffer*         buffer;
+  uint32_t               buffer_size;
+  SDL_GPUTransferBuffer* upload_buffer;  // Copied to buffer by the next copy pass.
+  Retained_Draw*         draws;
+  uint32_t               draw_count;
+};
+
+// Consecutive records submitted in the same depth mode, drawn with one pipeline.
+struct Depth_Run {
+  Im3d_SDL3_GPU_Depth_Mode depth_mode;  // Of the current Im3d layer when submitted.
+  uint32_t                 first;       // Of the run's records.
+  uint32_t                 count;
+  uint32_t                 line_count;  // Of the run's shapes, their first lines start at 0.
+};
+
+// Runs are recorded until the next prepare and drawn after it, so their owner keeps two lists and
+// swaps them, see swap_depth_runs.
+struct Depth_Runs {
+  Depth_Run* runs;
+  uint32_t   capacity;
+  uint32_t   count;
+};
+
+// A mesh of im3d_sdl3_gpu_create_mesh, the slot is free when buffer is null.
+struct Mesh {
+  Im3d_SDL3_GPU_Mesh_Type      type;
+  SDL_GPUBuffer*               buffer;
+  uint32_t                     vertex_count;
+  SDL_GPUTransferBuffer*       upload_buffer;  // Copied to buffer by the next copy pass.
+  Im3d_SDL3_GPU_Mesh_Instance* instances;      // Submitted since the last prepare.
+  uint32_t                     instance_capacity;
+  uint32_t                     instance_count;
+  uint32_t                     first_draw_instance;  // Into the mesh instance ring's region.
+  uint32_t                     draw_instance_count;
+  Depth_Runs                   runs;       // Of instances, submitted since the last prepare.
+  Depth_Runs                   draw_runs;  // Of the instances drawn this frame.
+};
+
+// A shape of im3d_sdl3_gpu_draw_shapes or im3d_sdl3_gpu_draw_filled_shapes, see load_shape in
+// im3d_sdl3_gpu.hlsl.
+struct Shape_Record {
+  uint32_t    first_line;  // Of the shape's lines, which are drawn as one instance each.
+  uint32_t    type;
+  uint32_t    detail;    // Lines per ring.
+  uint32_t    adaptive;  // The vertex shader picks the detail, up to detail.
+  Im3d::Vec3  position;
+  float       radius;
+  Im3d::Vec3  direction;
+  float       size;
+  Im3d::Color color;
+  uint32_t    padding[3];
+};
+static_assert(sizeof(Shape_Record) == 64, "Shape_Record must be 64 bytes");
+
+// A glyph of the font, see the text vertex shader in im3d_sdl3_gpu.hlsl.
+struct Glyph_Record {
+  Im3d::Vec4 plane_rect;
+  Im3d::Vec4 uv_rect;
+};
+static_assert(sizeof(Glyph_Record) == 32, "Glyph_Record must be 32 bytes");
+
+// A glyph of Im3d::Text, expanded into a quad by the text vertex shader.
+struct Glyph_Instance {
+  Im3d::Vec3  position;  // Of the text.
+  float       size;
+  Im3d::Vec2  offset;    // Of the glyph's pen from position, in pixels of text size 1, y down.
+  uint32_t    glyph;     // Into the glyph buffer.
+  Im3d::Color color;
+};
+static_assert(sizeof(Glyph_Instance) == 32, "Glyph_Instance must be 32 bytes");
+
+// A glyph of a laid out string, at its pen's offset from the text position.
+struct Text_Run_Glyph {
+  Im3d::Vec2 offset;  // In pixels of text size 1, y down.
+  uint32_t   glyph;   // Into the glyph buffer.
+};
+
+// A string laid out for a set of text flags, kept across frames, see find_text_run. The string
+// follows the glyphs in the same allocation, to tell apart texts with the same key.
+struct Text_Run {
+  uint64_t        key;  // 0 = empty.
+  uint32_t        flags;
+  uint32_t        text_length;
+  uint32_t        glyph_count;
+  uint32_t        last_used_frame;
+  uint32_t        data_capacity;  // Bytes.
+  Text_Run_Glyph* glyphs;         // text_length glyphs, then the text.
+};
+
+// The glyph instances of a text draw list, drawn with a single instanced draw.
+struct Text_Draw {
+  uint32_t    first_instance;  // Into the text ring's region.
+  uint32_t    instance_count;
+  Depth_State depth_state;
+};
+
+// Per layer settings, see im3d_sdl3_gpu_set_layer_generation,
+// im3d_sdl3_gpu_set_layer_reorderable and im3d_sdl3_gpu_set_layer_depth_mode.
+struct Layer_Info {
+  Im3d::Id                 layer_id;
+  bool                     has_generation;
+  uint64_t                 generation;
+  uint32_t                 seen_frame;  // Last frame_index with a draw list in the layer.
+  bool                     has_reorderable;
+  bool                     reorderable;
+  Im3d_SDL3_GPU_Depth_Mode depth_mode;
+};
+
+// Byte range of the current data region which needs to be uploaded.
+struct Upload_Range {
+  uint32_t offset;
+  uint32_t size;
+};
+
+// A slice of a draw list to write into the upload buffer, packed draw lists are a single job since
+// the whole list is needed to compute the quantization bounds.
+struct Copy_Job {
+  uint32_t draw_list_index;
+  uint32_t first_vertex;
+  uint32_t vertex_count;
+  bool     non_temporal;
+};
+
+// A buffer rewritten every frame, uploaded from a transfer buffer with one region per data region.
+struct Upload_Ring {
+  SDL_GPUBuffer*         buffer;
+  SDL_GPUTransferBuffer* transfer_buffer;
+  uint32_t               region_size;
+  uint32_t               size;  // Bytes written to the current region this frame.
+};
+
+// SDL_SetGPUAllowedFramesInFlight defaults to 2 when the device is created.
+static constexpr uint32_t DEFAULT_FRAMES_IN_FLIGHT = 2;
+
+static constexpr float    DEFAULT_BUFFER_GROWTH_FACTOR = 1.5f;
+static constexpr uint32_t MIN_DATA_REGION_SIZE         = 64 * 1024;
+static constexpr uint32_t DATA_REGION_ALIGNMENT        = 256;
+
+static constexpr uint32_t MAX_COPY_THREADS           = 16;
+static constexpr uint64_t PARALLEL_COPY_MIN_SIZE     = 1024 * 1024;
+static constexpr uint32_t COPY_JOB_SIZE              = 256 * 1024;
+static constexpr uint64_t NON_TEMPORAL_COPY_MIN_SIZE = 256 * 1024;
+
+static constexpr uint32_t UPLOAD_RANGE_MERGE_GAP = 4 * 1024;
+static constexpr uint32_t MIN_DRAW_CAPACITY      = 64;
+
+// Smaller batches are drawn as is, culling them costs more than rasterizing them.
+static constexpr uint32_t MIN_CULL_INSTANCE_COUNT = 1024;
+static constexpr uint32_t CULL_THREAD_COUNT       = 64;
+static constexpr uint32_t CULL_GROUPS_PER_ROW     = 32768;
+static constexpr uint32_t MIN_CULL_CAPACITY       = 64 * 1024;
+
+// 8 bit digits of 32 bit keys, each sort pass is a count, scan and scatter step. The scan step
+// runs a group per digit.
+static constexpr uint32_t SORT_GROUP_SIZE   = 256;
+static constexpr uint32_t SORT_DIGIT_COUNT  = 256;
+static constexpr uint32_t SORT_PASS_COUNT   = 4;
+static constexpr uint32_t SORT_STEP_COUNT   = 1 + SORT_PASS_COUNT * 3;
+static constexpr uint32_t MAX_SORT_GROUPS   = 65535;
+static constexpr uint32_t MIN_SORT_CAPACITY = 16 * 1024;
+
+// Render target configurations with pipelines, found through a table with twice as many slots.
+static constexpr uint32_t MAX_RENDER_TARGETS       = 16;
+static constexpr uint32_t RENDER_TARGET_SLOT_COUNT = MAX_RENDER_TARGETS * 2;
+
+// Lines per ring of shapes with adaptive detail, see load_shape_line in im3d_sdl3_gpu.hlsl.
+static constexpr uint32_t MAX_SHAPE_DETAIL = 64;
+static constexpr uint32_t MIN_SHAPE_DETAIL = 4;
+
+// The dynamic overlay scale drops quickly while the frame is over budget and recovers slowly once
+// it is comfortably under, so it doesn't oscillate around the budget.
+static constexpr float DEFAULT_OVERLAY_MIN_SCALE = 0.5f;
+static constexpr float OVERLAY_SCALE_DECAY       = 0.9f;
+static constexpr float OVERLAY_SCALE_RECOVERY    = 0.01f;
+static constexpr float OVERLAY_BUDGET_HEADROOM   = 0.85f;
+
+// Text runs are cached in sets of TEXT_RUN_WAYS, a miss replaces the least recently used run of
+// its set.
+static constexpr uint32_t DEFAULT_TEXT_CACHE_SIZE = 4096;
+static constexpr uint32_t TEXT_RUN_WAYS           = 4;
+static constexpr uint32_t REPLACEMENT_CHARACTER   = 0xFFFD;
+
+static constexpr uint32_t PACKED_POSITION_MAX_XY = (1u << 21) - 1;
+static constexpr uint32_t PACKED_POSITION_MAX_Z  = (1u << 22) - 1;
+
 static struct {
-  Im3d_SDL3_GPU_Init_Info  init_info;
-  SDL_GPUGraphicsPipeline* pipeline_points;
-  SDL_GPUGraphicsPipeline* pipeline_lines;
-  SDL_GPUGraphicsPipeline* pipeline_triangles;
-  SDL_GPUBuffer*           vertex_buffer;
-  SDL_GPUBuffer*           data_buffer;
-  SDL_GPUTransferBuffer*   transfer_buffer;
-  uint32_t                 data_buffer_size;
-  uint32_t                 total_vertex_count;
-  Im3d::Mat4               world_to_clip_transform;
-  int                      keyboard_state[SDL_SCANCODE_COUNT];
+  Im3d_SDL3_GPU_Init_Info    init_info;
+  SDL_GPUShaderFormat        shader_format;
+  Shader_Pack                shader_pack;
+  Graphics_Pipeline_Desc     graphics_pipeline_descs[GRAPHICS_PIPELINE_KIND_COUNT];
+  Target_Pipelines           target_pipelines[MAX_RENDER_TARGETS];
+  uint32_t                   target_pipeline_count;
+  uint8_t                    target_pipeline_slots[RENDER_TARGET_SLOT_COUNT];  // Index + 1 or 0.
+  Compute_Pipeline_Desc      compute_pipeline_descs[COMPUTE_PIPELINE_KIND_COUNT];
+  SDL_GPUComputePipeline*    compute_pipelines[COMPUTE_PIPELINE_KIND_COUNT];
+  bool                       compute_pipeline_failed[COMPUTE_PIPELINE_KIND_COUNT];
+  SDL_GPUBuffer*             vertex_buffer;
+  SDL_GPUTransferBuffer*     vertex_upload_buffer;  // The quad, copied by the first copy pass.
+  SDL_GPUBuffer*             data_buffer;
+  SDL_GPUTransferBuffer*     transfer_buffer;
+  SDL_GPUTransferBuffer*     retired_transfer_buffer;
+  uint8_t*                   mapped_data;
+  uint32_t                   vertex_stride;
+  Draw_List_Info*            draw_list_infos;
+  uint32_t                   draw_list_info_capacity;
+  uint32_t                   draw_list_info_count;
+  Upload_Range*              upload_ranges;
+  uint32_t                   upload_range_capacity;
+  uint32_t                   upload_range_count;
+  SDL_GPUBuffer*             resident_buffer;
+  SDL_GPUBuffer*             retired_resident_buffer;
+  uint32_t                   resident_capacity;
+  uint32_t                   resident_size;
+  uint32_t                   resident_live_size;
+  Layer_Info*                layer_infos;
+  Retained_Layer*            retained_layers;
+  uint32_t                   retained_layer_count;
+  SDL_GPUBuffer*             draw_buffer;
+  SDL_GPUTransferBuffer*     draw_transfer_buffer;
+  uint32_t                   draw_capacity;
+  Draw_Batch*                draw_batches;
+  uint32_t                   draw_batch_capacity;
+  uint32_t                   draw_batch_count;
+  uint32_t                   draw_segment_count;
+  uint32_t*                  draw_order;
+  uint32_t                   draw_order_capacity;
+  Upload_Ring                index_ring;
+  Mesh*                      meshes;
+  uint32_t                   mesh_count;
+  Upload_Ring                mesh_instance_ring;
+  Shape_Record*              shapes;  // Submitted since the last prepare.
+  uint32_t                   shape_capacity;
+  uint32_t                   shape_count;
+  Depth_Runs                 shape_runs;
+  Upload_Ring                shape_ring;
+  uint32_t                   shape_draw_count;
+  Depth_Runs                 shape_draw_runs;
+  Shape_Record*              impostors;  // Filled shapes submitted since the last prepare.
+  uint32_t                   impostor_capacity;
+  uint32_t                   impostor_count;
+  Depth_Runs                 impostor_runs;
+  Upload_Ring                impostor_ring;
+  uint32_t                   impostor_draw_count;
+  Depth_Runs                 impostor_draw_runs;
+  Im3d_SDL3_GPU_Font_Type    font_type;
+  SDL_GPUTexture*            font_atlas;
+  float                      font_line_height;
+  Im3d_SDL3_GPU_Glyph*       font_glyphs;  // Sorted by codepoint.
+  uint32_t                   font_glyph_count;
+  const Im3d_SDL3_GPU_Glyph* font_fallback_glyph;     // '?', drawn for missing glyphs.
+  const Im3d_SDL3_GPU_Glyph* font_ascii_glyphs[128];  // Or the fallback glyph.
+  SDL_GPUBuffer*             font_glyph_buffer;
+  SDL_GPUTransferBuffer*     font_upload_buffer;  // Copied by the next copy pass.
+  Text_Run*                  text_runs;  // Allocated with the first font.
+  uint32_t                   text_run_set_count;
+  Upload_Ring                text_ring;
+  Text_Draw*                 text_draws;
+  uint32_t                   text_draw_capacity;
+  uint32_t                   text_draw_count;
+  SDL_GPUBuffer*             cull_buffer;
+  uint32_t                   cull_draw_capacity;
+  uint32_t                   cull_instance_capacity;
+  uint32_t                   cull_instance_count;
+  bool                       cull_commands;  // This frame's draw commands are in the cull buffer.
+  SDL_GPUBuffer*             sort_buffer;
+  uint32_t                   sort_capacity;
+  uint32_t                   sort_instance_count;
+  uint32_t                   layer_info_count;
+  uint32_t                   frame_index;
+  uint32_t                   data_buffer_generation;
+  uint32_t                   data_region_size;
+  uint32_t                   data_region_count;
+  uint32_t                   data_region_index;
+  uint32_t                   data_quiet_frame_count;
+  uint32_t                   total_vertex_count;
+  bool                       budget_warning_logged;
+  bool                       sort_warning_logged;
+  Copy_Job*                  copy_jobs;
+  uint32_t                   copy_job_capacity;
+  uint32_t                   copy_job_count;
+  SDL_AtomicInt              copy_job_next;
+  uint8_t*                   copy_region_data;
+  SDL_Thread*                copy_threads[MAX_COPY_THREADS];
+  uint32_t                   copy_thread_count;
+  SDL_Semaphore*             copy_start_semaphore;
+  SDL_Semaphore*             copy_done_semaphore;
+  SDL_AtomicInt              copy_threads_quit;
+  SDL_GPUSampler*            linear_sampler;  // Of the overlay and the font atlas.
+  SDL_GPUTexture*            overlay_texture;
+  uint32_t                   overlay_width;  // Of the overlay target, at overlay_scale.
+  uint32_t                   overlay_height;
+  float                      overlay_scale;      // Dynamic, of the viewport.
+  Im3d::Vec2                 overlay_draw_size;  // Drawn this frame, 0 when nothing was.
+  Im3d_SDL3_GPU_Memory_Stats memory_stats;
+  Im3d::Mat4                 world_to_clip_transform;
+  Im3d::Mat4                 clip_to_world_transform;
+  int                        keyboard_state[SDL_SCANCODE_COUNT];
 } g_data = {};
 
-bool im3d_sdl3_gpu_init(const Im3d_SDL3_GPU_Init_Info& info) {
-  SDL_assert(info.device != nullptr);
+static void track_memory(int64_t delta_bytes) {
+  g_data.memory_stats.current_bytes += delta_bytes;
+  g_data.memory_stats.peak_bytes =
+      SDL_max(g_data.memory_stats.peak_bytes, g_data.memory_stats.current_bytes);
+}
 
-  g_data.init_info = info;
+// Whether delta_bytes more tracked GPU memory stays within memory_budget. Going over isn't an
+// error, the caller drops or degrades what the memory was for, so it's only logged once.
+static bool within_memory_budget(int64_t delta_bytes, const char* name) {
+  if (g_data.init_info.memory_budget == 0 || delta_bytes <= 0) { return true; }
+  if (g_data.memory_stats.current_bytes + uint64_t(delta_bytes) <= g_data.init_info.memory_budget) {
+    return true;
+  }
+  if (!g_data.budget_warning_logged) {
+    SDL_LogWarn(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Im3d %s buffer needs %lld more bytes which exceeds the memory budget, dropping draws",
+        name,
+        static_cast<long long>(delta_bytes));
+    g_data.budget_warning_logged = true;
+  }
+  return false;
+}
+
+static void release_upload_ring(Upload_Ring& ring) {
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, ring.buffer);
+  SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, ring.transfer_buffer);
+  track_memory(-2 * int64_t(ring.region_size) * g_data.data_region_count);
+  ring = {};
+}
+
+// Vertex data and draws are also read by the cull pass when gpu_culling is enabled,
+// and by the sort keys pass when gpu_sorting is enabled.
+static SDL_GPUBufferUsageFlags storage_buffer_usage() {
+  SDL_GPUBufferUsageFlags usage = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
+  if (g_data.init_info.gpu_culling || g_data.init_info.gpu_sorting) {
+    usage |= SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ;
+  }
+  return usage;
+}
 
+static bool create_data_buffers(uint32_t region_size) {
+  SDL_GPUBuffer* data_buffer;
   {
-    const uint8_t *shader_points_vert_data, *shader_points_frag_data;
-    uint64_t       shader_points_vert_size, shader_points_frag_size;
-    const uint8_t *shader_lines_vert_data, *shader_lines_frag_data;
-    uint64_t       shader_lines_vert_size, shader_lines_frag_size;
-    const uint8_t *shader_triangles_vert_data, *shader_triangles_frag_data;
-    uint64_t       shader_triangles_vert_size, shader_triangles_frag_size;
-
-    const char*         driver = SDL_GetGPUDeviceDriver(g_data.init_info.device);
-    SDL_GPUShaderFormat shader_format;
-    if (SDL_strcmp(driver, "vulkan") == 0) {
-      shader_format              = SDL_GPU_SHADERFORMAT_SPIRV;
-      shader_points_vert_data    = im3d_points_vert_spv;
-      shader_points_vert_size    = sizeof(im3d_points_vert_spv);
-      shader_points_frag_data    = im3d_points_frag_spv;
-      shader_points_frag_size    = sizeof(im3d_points_frag_spv);
-      shader_lines_vert_data     = im3d_lines_vert_spv;
-      shader_lines_vert_size     = sizeof(im3d_lines_vert_spv);
-      shader_lines_frag_data     = im3d_lines_frag_spv;
-      shader_lines_frag_size     = sizeof(im3d_lines_frag_spv);
-      shader_triangles_vert_data = im3d_triangles_vert_spv;
-      shader_triangles_vert_size = sizeof(im3d_triangles_vert_spv);
-      shader_triangles_frag_data = im3d_triangles_frag_spv;
-      shader_triangles_frag_size = sizeof(im3d_triangles_frag_spv);
-    } else if (SDL_strcmp(driver, "direct3d12") == 0) {
-      shader_format              = SDL_GPU_SHADERFORMAT_DXIL;
-      shader_points_vert_data    = im3d_points_vert_dxil;
-      shader_points_vert_size    = sizeof(im3d_points_vert_dxil);
-      shader_points_frag_data    = im3d_points_frag_dxil;
-      shader_points_frag_size    = sizeof(im3d_points_frag_dxil);
-      shader_lines_vert_data     = im3d_lines_vert_dxil;
-      shader_lines_vert_size     = sizeof(im3d_lines_vert_dxil);
-      shader_lines_frag_data     = im3d_lines_frag_dxil;
-      shader_lines_frag_size     = sizeof(im3d_lines_frag_dxil);
-      shader_triangles_vert_data = im3d_triangles_vert_dxil;
-      shader_triangles_vert_size = sizeof(im3d_triangles_vert_dxil);
-      shader_triangles_frag_data = im3d_triangles_frag_dxil;
-      shader_triangles_frag_size = sizeof(im3d_triangles_frag_dxil);
-    } else if (SDL_strcmp(driver, "metal") == 0) {
-      SDL_GPUShaderFormat supported_formats = SDL_GetGPUShaderFormats(g_data.init_info.device);
-      if (supported_formats & SDL_GPU_SHADERFORMAT_METALLIB) {
-        shader_format = SDL_GPU_SHADERFORMAT_METALLIB;
-        // TODO: Add metallib shaders.
-        SDL_assert(false);
-      } else if (supported_formats & SDL_GPU_SHADERFORMAT_MSL) {
-        shader_format              = SDL_GPU_SHADERFORMAT_MSL;
-        shader_points_vert_data    = im3d_points_vert_msl;
-        shader_points_vert_size    = sizeof(im3d_points_vert_msl);
-        shader_points_frag_data    = im3d_points_frag_msl;
-        shader_points_frag_size    = sizeof(im3d_points_frag_msl);
-        shader_lines_vert_data     = im3d_lines_vert_msl;
-        shader_lines_vert_size     = sizeof(im3d_lines_vert_msl);
-        shader_lines_frag_data     = im3d_lines_frag_msl;
-        shader_lines_frag_size     = sizeof(im3d_lines_frag_msl);
-        shader_triangles_vert_data = im3d_triangles_vert_msl;
-        shader_triangles_vert_size = sizeof(im3d_triangles_vert_msl);
-        shader_triangles_frag_data = im3d_triangles_frag_msl;
-        shader_triangles_frag_size = sizeof(im3d_triangles_frag_msl);
-      }
-    } else {
+    SDL_GPUBufferCreateInfo info = {};
+    info.size                    = region_size * g_data.data_region_count;
+    info.usage                   = storage_buffer_usage();
+    data_buffer                  = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+    if (data_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create data buffer: %s",
+          SDL_GetError());
+      return false;
+    }
+  }
+  SDL_GPUTransferBuffer* transfer_buffer;
+  {
+    SDL_GPUTransferBufferCreateInfo info = {};
+    info.size                            = region_size * g_data.data_region_count;
+    info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
+    if (transfer_buffer == nullptr) {
       SDL_LogError(
           SDL_LOG_CATEGORY_APPLICATION,
-          "Im3d SDL3 GPU backend does not support this GPU device driver");
+          "Failed to create transfer buffer: %s",
+          SDL_GetError());
+      SDL_ReleaseGPUBuffer(g_data.init_info.device, data_buffer);
       return false;
     }
+  }
 
-    SDL_GPUColorTargetDescription color_target_desc     = {};
-    color_target_desc.format                            = g_data.init_info.color_target_format;
-    color_target_desc.blend_state.enable_blend          = true;
-    color_target_desc.blend_state.color_blend_op        = SDL_GPU_BLENDOP_ADD;
-    color_target_desc.blend_state.alpha_blend_op        = SDL_GPU_BLENDOP_ADD;
-    color_target_desc.blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
-    color_target_desc.blend_state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-    color_target_desc.blend_state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
-    color_target_desc.blend_state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ZERO;
-    color_target_desc.blend_state.color_write_mask =
-        SDL_GPU_COLORCOMPONENT_R | SDL_GPU_COLORCOMPONENT_G | SDL_GPU_COLORCOMPONENT_B |
-        SDL_GPU_COLORCOMPONENT_A;
-
-    SDL_GPUVertexBufferDescription vertex_buffer_desc = {};
-    vertex_buffer_desc.slot                           = 0;
-    vertex_buffer_desc.pitch                          = sizeof(Im3d::Vec4);
-    vertex_buffer_desc.input_rate                     = SDL_GPU_VERTEXINPUTRATE_VERTEX;
-
-    SDL_GPUVertexAttribute vertex_attribute = {};
-    vertex_attribute.location               = 0;
-    vertex_attribute.buffer_slot            = 0;
-    vertex_attribute.format                 = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4;
-
-    SDL_GPUGraphicsPipelineCreateInfo pipeline_info             = {};
-    pipeline_info.vertex_input_state.num_vertex_buffers         = 1;
-    pipeline_info.vertex_input_state.vertex_buffer_descriptions = &vertex_buffer_desc;
-    pipeline_info.vertex_input_state.num_vertex_attributes      = 1;
-    pipeline_info.vertex_input_state.vertex_attributes          = &vertex_attribute;
-    pipeline_info.target_info.num_color_targets                 = 1;
-    pipeline_info.target_info.color_target_descriptions         = &color_target_desc;
-    pipeline_info.primitive_type                 = SDL_GPU_PRIMITIVETYPE_TRIANGLELIST;
-    pipeline_info.multisample_state.sample_count = g_data.init_info.msaa_samples;
-
-    // Points pipeline.
-    {
-      SDL_GPUShader* vertex_shader;
-      {
-        SDL_GPUShaderCreateInfo info = {};
-        info.code                    = shader_points_vert_data;
-        info.code_size               = shader_points_vert_size;
-        info.entrypoint              = "main";
-        info.format                  = shader_format;
-        info.num_storage_buffers     = 1;
-        info.num_uniform_buffers     = 1;
-        info.stage                   = SDL_GPU_SHADERSTAGE_VERTEX;
-        vertex_shader                = SDL_CreateGPUShader(g_data.init_info.device, &info);
-        if (vertex_shader == nullptr) {
-          SDL_LogError(
-              SDL_LOG_CATEGORY_APPLICATION,
-              "Failed to create points vertex shader: %s",
-              SDL_GetError());
-          return false;
-        }
-      }
+  // SDL defers destroying released buffers until the command buffers referencing them have
+  // completed, so the old ring can be dropped without waiting for the GPU to go idle. A transfer
+  // buffer that is still mapped holds vertices emitted in place, it is released once they have been
+  // copied over.
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.data_buffer);
+  if (g_data.mapped_data != nullptr) {
+    SDL_assert(g_data.retired_transfer_buffer == nullptr);
+    g_data.retired_transfer_buffer = g_data.transfer_buffer;
+    g_data.mapped_data             = nullptr;
+  } else {
+    SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.transfer_buffer);
+  }
 
-      SDL_GPUShader* fragment_shader;
-      {
-        SDL_GPUShaderCreateInfo info = {};
-        info.code                    = shader_points_frag_data;
-        info.code_size               = shader_points_frag_size;
-        info.entrypoint              = "main";
-        info.format                  = shader_format;
-        info.stage                   = SDL_GPU_SHADERSTAGE_FRAGMENT;
-        fragment_shader              = SDL_CreateGPUShader(g_data.init_info.device, &info);
-        if (fragment_shader == nullptr) {
-          SDL_LogError(
-              SDL_LOG_CATEGORY_APPLICATION,
-              "Failed to create points fragment shader: %s",
-              SDL_GetError());
-          return false;
-        }
-      }
+  int64_t ring_size_old = 2 * int64_t(g_data.data_region_size) * g_data.data_region_count;
+  int64_t ring_size_new = 2 * int64_t(region_size) * g_data.data_region_count;
+  track_memory(ring_size_new - ring_size_old);
 
-      SDL_GPUGraphicsPipelineCreateInfo info = pipeline_info;
-      info.primitive_type                    = SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP;
-      info.vertex_shader                     = vertex_shader;
-      info.fragment_shader                   = fragment_shader;
-      g_data.pipeline_points = SDL_CreateGPUGraphicsPipeline(g_data.init_info.device, &info);
-      if (g_data.pipeline_points == nullptr) {
-        SDL_LogError(
-            SDL_LOG_CATEGORY_APPLICATION,
-            "Failed to create points pipeline: %s",
-            SDL_GetError());
-        return false;
-      }
+  g_data.data_buffer      = data_buffer;
+  g_data.transfer_buffer  = transfer_buffer;
+  g_data.data_region_size = region_size;
+  g_data.data_buffer_generation++;
+  return true;
+}
 
-      SDL_ReleaseGPUShader(g_data.init_info.device, vertex_shader);
-      SDL_ReleaseGPUShader(g_data.init_info.device, fragment_shader);
+// Grows the upload ring geometrically, trims it after buffer_shrink_frames consecutive frames that
+// would fit in a much smaller ring, and keeps the data and transfer buffers within memory_budget.
+static bool reserve_data_buffers(uint64_t data_size) {
+  float growth_factor = g_data.init_info.buffer_growth_factor > 1.0f
+                            ? g_data.init_info.buffer_growth_factor
+                            : DEFAULT_BUFFER_GROWTH_FACTOR;
+
+  uint64_t region_size = g_data.data_region_size;
+  if (data_size > region_size) {
+    region_size = SDL_max(uint64_t(region_size * growth_factor), data_size);
+  } else if (
+      g_data.init_info.buffer_shrink_frames > 0 && region_size > MIN_DATA_REGION_SIZE &&
+      data_size * growth_factor * growth_factor < region_size) {
+    if (++g_data.data_quiet_frame_count < g_data.init_info.buffer_shrink_frames) { return true; }
+    region_size = uint64_t(data_size * growth_factor);
+  } else {
+    g_data.data_quiet_frame_count = 0;
+    return true;
+  }
+  g_data.data_quiet_frame_count = 0;
+
+  region_size = SDL_max(region_size, uint64_t(MIN_DATA_REGION_SIZE));
+  region_size = (region_size + DATA_REGION_ALIGNMENT - 1) & ~uint64_t(DATA_REGION_ALIGNMENT - 1);
+
+  // Each region is backed by both the data buffer and the transfer buffer.
+  uint64_t max_region_size = SDL_MAX_UINT32 / g_data.data_region_count;
+  if (g_data.init_info.memory_budget > 0) {
+    uint64_t ring_bytes  = 2 * uint64_t(g_data.data_region_size) * g_data.data_region_count;
+    uint64_t other_bytes = g_data.memory_stats.current_bytes - ring_bytes;
+    uint64_t ring_budget = g_data.init_info.memory_budget > other_bytes
+                               ? g_data.init_info.memory_budget - other_bytes
+                               : 0;
+    max_region_size      = SDL_min(max_region_size, ring_budget / (2 * g_data.data_region_count));
+  }
+  max_region_size &= ~uint64_t(DATA_REGION_ALIGNMENT - 1);
+  if (region_size > max_region_size) {
+    if (!g_data.budget_warning_logged) {
+      SDL_LogWarn(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Im3d frame needs %llu bytes which exceeds the memory budget, dropping vertices",
+          static_cast<unsigned long long>(data_size));
+      g_data.budget_warning_logged = true;
     }
+    region_size = max_region_size;
+  }
 
-    // Lines pipeline.
-    {
-      SDL_GPUShader* vertex_shader;
-      {
-        SDL_GPUShaderCreateInfo info = {};
-        info.code                    = shader_lines_vert_data;
-        info.code_size               = shader_lines_vert_size;
-        info.entrypoint              = "main";
-        info.format                  = shader_format;
-        info.num_storage_buffers     = 1;
-        info.num_uniform_buffers     = 1;
-        info.stage                   = SDL_GPU_SHADERSTAGE_VERTEX;
-        vertex_shader                = SDL_CreateGPUShader(g_data.init_info.device, &info);
-        if (vertex_shader == nullptr) {
-          SDL_LogError(
-              SDL_LOG_CATEGORY_APPLICATION,
-              "Failed to create lines vertex shader: %s",
-              SDL_GetError());
-          return false;
-        }
-      }
+  if (region_size == g_data.data_region_size || region_size == 0) { return true; }
+  return create_data_buffers(uint32_t(region_size));
+}
 
-      SDL_GPUShader* fragment_shader;
-      {
-        SDL_GPUShaderCreateInfo info = {};
-        info.code                    = shader_lines_frag_data;
-        info.code_size               = shader_lines_frag_size;
-        info.entrypoint              = "main";
-        info.format                  = shader_format;
-        info.stage                   = SDL_GPU_SHADERSTAGE_FRAGMENT;
-        fragment_shader              = SDL_CreateGPUShader(g_data.init_info.device, &info);
-        if (fragment_shader == nullptr) {
-          SDL_LogError(
-              SDL_LOG_CATEGORY_APPLICATION,
-              "Failed to create lines fragment shader: %s",
-              SDL_GetError());
-          return false;
-        }
+// Returns how many vertices of draw_list fit in vertex_capacity, rounded down to whole primitives.
+static uint32_t fit_draw_list(const Im3d::DrawList& draw_list, uint32_t vertex_capacity) {
+  uint32_t vertex_count = SDL_min(draw_list.m_vertexCount, vertex_capacity);
+  switch (draw_list.m_primType) {
+  case Im3d::DrawPrimitive_Lines:
+    vertex_count -= vertex_count % 2;
+    break;
+  case Im3d::DrawPrimitive_Triangles:
+    vertex_count -= vertex_count % 3;
+    break;
+  case Im3d::DrawPrimitive_IndexedTriangles:
+    // The indices may refer to any vertex of the list.
+    if (vertex_count < draw_list.m_vertexCount) { vertex_count = 0; }
+    break;
+  default:
+    break;
+  }
+  return vertex_count;
+}
+
+// Indexed triangles are expanded into plain triangles as they are written when triangles are
+// antialiased analytically, a vertex shared between triangles can't be moved out along the edges of
+// each of them. The overlay is always single sampled.
+static bool expand_indexed_triangles(const Im3d::DrawList& draw_list) {
+  return draw_list.m_primType == Im3d::DrawPrimitive_IndexedTriangles &&
+         (g_data.init_info.msaa_samples == SDL_GPU_SAMPLECOUNT_1 ||
+          g_data.init_info.overlay_scale > 0.0f);
+}
+
+// Returns how many vertices of the expanded indexed draw_list fit in vertex_capacity, rounded down
+// to whole triangles.
+static uint32_t fit_expanded_draw_list(const Im3d::DrawList& draw_list, uint32_t vertex_capacity) {
+  uint32_t vertex_count = SDL_min(draw_list.m_indexCount, vertex_capacity);
+  return vertex_count - vertex_count % 3;
+}
+
+// Writes vertex_count vertices of draw_list quantized to the draw list bounds, which are returned
+// in info for the vertex shader to reconstruct the positions. With indices, dst[i] is the vertex
+// indices[i] and the bounds only cover the indexed vertices.
+static void pack_draw_list(
+    const Im3d::DrawList& draw_list,
+    uint32_t              vertex_count,
+    Packed_Vertex_Data*   dst,
+    Draw_List_Info*       info,
+    const uint32_t*       indices = nullptr) {
+  if (vertex_count == 0) { return; }
+
+  const Im3d::VertexData* vertices = draw_list.m_vertexData;
+  Im3d::Vec3 position_min = Im3d::Vec3(vertices[indices ? indices[0] : 0].m_positionSize);
+  Im3d::Vec3 position_max = position_min;
+  for (uint32_t i = 1; i < vertex_count; i++) {
+    Im3d::Vec3 position = Im3d::Vec3(vertices[indices ? indices[i] : i].m_positionSize);
+    position_min        = Im3d::Min(position_min, position);
+    position_max        = Im3d::Max(position_max, position);
+  }
+
+  Im3d::Vec3 extent     = position_max - position_min;
+  Im3d::Vec3 max_values = Im3d::Vec3(
+      static_cast<float>(PACKED_POSITION_MAX_XY),
+      static_cast<float>(PACKED_POSITION_MAX_XY),
+      static_cast<float>(PACKED_POSITION_MAX_Z));
+  Im3d::Vec3 quantize_scale;
+  for (int axis = 0; axis < 3; axis++) {
+    quantize_scale[axis] = extent[axis] > 0.0f ? max_values[axis] / extent[axis] : 0.0f;
+  }
+  info->position_origin = position_min;
+  info->position_scale  = Im3d::Vec3(
+      extent.x / max_values.x,
+      extent.y / max_values.y,
+      extent.z / max_values.z);
+
+  for (uint32_t i = 0; i < vertex_count; i++) {
+    const Im3d::VertexData& src = vertices[indices ? indices[i] : i];
+
+    Im3d::Vec3 position = (Im3d::Vec3(src.m_positionSize) - position_min) * quantize_scale;
+    uint32_t   x        = SDL_min(uint32_t(position.x + 0.5f), PACKED_POSITION_MAX_XY);
+    uint32_t   y        = SDL_min(uint32_t(position.y + 0.5f), PACKED_POSITION_MAX_XY);
+    uint32_t   z        = SDL_min(uint32_t(position.z + 0.5f), PACKED_POSITION_MAX_Z);
+    dst[i].position[0]  = x | (y << 21);
+    dst[i].position[1]  = (y >> 11) | (z << 10);
+    dst[i].color        = src.m_color;
+    dst[i].size         = src.m_positionSize.w;
+  }
+}
+
+// Copies with streaming stores so that large lists don't evict the caches on their way to the
+// (usually write-combined) transfer buffer memory.
+static void copy_vertex_data(void* dst, const void* src, size_t size, bool non_temporal) {
+#if defined(SDL_SSE2_INTRINSICS)
+  if (non_temporal && ((uintptr_t(dst) | uintptr_t(src) | size) & 15) == 0) {
+    auto dst_vectors = static_cast<__m128i*>(dst);
+    auto src_vectors = static_cast<const __m128i*>(src);
+    for (size_t i = 0; i < size / 16; i++) {
+      _mm_stream_si128(dst_vectors + i, _mm_load_si128(src_vectors + i));
+    }
+    _mm_sfence();
+    return;
+  }
+#endif
+  (void)non_temporal;
+  SDL_memcpy(dst, src, size);
+}
+
+static void run_copy_jobs() {
+  for (;;) {
+    uint32_t job_index = uint32_t(SDL_AddAtomicInt(&g_data.copy_job_next, 1));
+    if (job_index >= g_data.copy_job_count) { break; }
+
+    const Copy_Job&       job          = g_data.copy_jobs[job_index];
+    const Im3d::DrawList& draw_list    = Im3d::GetDrawLists()[job.draw_list_index];
+    Draw_List_Info&       info         = g_data.draw_list_infos[job.draw_list_index];
+    uint32_t              first_vertex = info.vertex_offset + job.first_vertex;
+    uint8_t*              dst = g_data.copy_region_data + first_vertex * g_data.vertex_stride;
+    const uint32_t*       indices = info.index_expanded ? draw_list.m_indexData : nullptr;
+    if (g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_PACKED) {
+      pack_draw_list(
+          draw_list,
+          job.vertex_count,
+          reinterpret_cast<Packed_Vertex_Data*>(dst),
+          &info,
+          indices);
+    } else if (indices != nullptr) {
+      auto vertices = reinterpret_cast<Im3d::VertexData*>(dst);
+      for (uint32_t i = 0; i < job.vertex_count; i++) {
+        vertices[i] = draw_list.m_vertexData[indices[job.first_vertex + i]];
       }
+    } else {
+      copy_vertex_data(
+          dst,
+          draw_list.m_vertexData + job.first_vertex,
+          job.vertex_count * sizeof(Im3d::VertexData),
+          job.non_temporal);
+    }
+  }
+}
 
-      SDL_GPUGraphicsPipelineCreateInfo info = pipeline_info;
-      info.primitive_type                    = SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP;
-      info.vertex_shader                     = vertex_shader;
-      info.fragment_shader                   = fragment_shader;
-      g_data.pipeline_lines = SDL_CreateGPUGraphicsPipeline(g_data.init_info.device, &info);
-      if (g_data.pipeline_lines == nullptr) {
-        SDL_LogError(
-            SDL_LOG_CATEGORY_APPLICATION,
-            "Failed to create lines pipeline: %s",
-            SDL_GetError());
-        return false;
+static int SDLCALL copy_thread_main(void* user_data) {
+  (void)user_data;
+  for (;;) {
+    SDL_WaitSemaphore(g_data.copy_start_semaphore);
+    if (SDL_GetAtomicInt(&g_data.copy_threads_quit) != 0) { break; }
+    run_copy_jobs();
+    SDL_SignalSemaphore(g_data.copy_done_semaphore);
+  }
+  return 0;
+}
+
+// Joins the copy threads that were started and destroys their semaphores.
+static void destroy_copy_threads() {
+  SDL_SetAtomicInt(&g_data.copy_threads_quit, 1);
+  for (uint32_t i = 0; i < g_data.copy_thread_count; i++) {
+    SDL_SignalSemaphore(g_data.copy_start_semaphore);
+  }
+  for (uint32_t i = 0; i < g_data.copy_thread_count; i++) {
+    SDL_WaitThread(g_data.copy_threads[i], nullptr);
+    g_data.copy_threads[i] = nullptr;
+  }
+  SDL_DestroySemaphore(g_data.copy_start_semaphore);
+  SDL_DestroySemaphore(g_data.copy_done_semaphore);
+  g_data.copy_start_semaphore = nullptr;
+  g_data.copy_done_semaphore  = nullptr;
+  g_data.copy_thread_count    = 0;
+  SDL_SetAtomicInt(&g_data.copy_threads_quit, 0);
+}
+
+static bool push_copy_job(uint32_t draw_list_index, uint32_t first_vertex, uint32_t vertex_count) {
+  if (g_data.copy_job_count == g_data.copy_job_capacity) {
+    uint32_t capacity  = SDL_max(64u, g_data.copy_job_capacity * 2);
+    auto     copy_jobs = static_cast<Copy_Job*>(
+        SDL_realloc(g_data.copy_jobs, capacity * sizeof(Copy_Job)));
+    if (copy_jobs == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate copy jobs");
+      return false;
+    }
+    g_data.copy_jobs         = copy_jobs;
+    g_data.copy_job_capacity = capacity;
+  }
+  Copy_Job& job       = g_data.copy_jobs[g_data.copy_job_count++];
+  job.draw_list_index = draw_list_index;
+  job.first_vertex    = first_vertex;
+  job.vertex_count    = vertex_count;
+  job.non_temporal    = uint64_t(vertex_count) * g_data.vertex_stride >= NON_TEMPORAL_COPY_MIN_SIZE;
+  return true;
+}
+
+// Runs the queued copy jobs on the calling thread, helped by the copy threads when there is enough
+// data to be worth waking them.
+static void execute_copy_jobs(uint64_t copy_size) {
+  SDL_SetAtomicInt(&g_data.copy_job_next, 0);
+
+  uint32_t thread_count = 0;
+  if (copy_size >= PARALLEL_COPY_MIN_SIZE && g_data.copy_job_count > 1) {
+    thread_count = SDL_min(g_data.copy_thread_count, g_data.copy_job_count - 1);
+  }
+  for (uint32_t i = 0; i < thread_count; i++) {
+    SDL_SignalSemaphore(g_data.copy_start_semaphore);
+  }
+  run_copy_jobs();
+  for (uint32_t i = 0; i < thread_count; i++) {
+    SDL_WaitSemaphore(g_data.copy_done_semaphore);
+  }
+}
+
+static void unmap_transfer_buffers() {
+  if (g_data.mapped_data != nullptr) {
+    SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.transfer_buffer);
+    g_data.mapped_data = nullptr;
+  }
+  if (g_data.retired_transfer_buffer != nullptr) {
+    SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.retired_transfer_buffer);
+    SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.retired_transfer_buffer);
+    g_data.retired_transfer_buffer = nullptr;
+  }
+}
+
+// Maps the next data region and hands it to Im3d as the storage for this frame's unsorted vertex
+// lists, so that im3d_sdl3_gpu_prepare_draw_data only has to copy the lists that did not fit. The
+// transfer buffer stays mapped from im3d_sdl3_gpu_new_frame until prepare_draw_data unmaps it
+// before recording its copy pass, or until shutdown. The mapping is usually write-combined, so
+// Im3d never reads it: strips and loops repeat vertices kept in its context, and only a list that
+// outgrows its slice reads the slice back once, when it moves to the heap.
+static void begin_vertex_emission() {
+  unmap_transfer_buffers();
+
+  g_data.mapped_data = static_cast<uint8_t*>(
+      SDL_MapGPUTransferBuffer(g_data.init_info.device, g_data.transfer_buffer, false));
+  if (g_data.mapped_data == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to map transfer buffer: %s",
+        SDL_GetError());
+    return;
+  }
+  g_data.data_region_index = (g_data.data_region_index + 1) % g_data.data_region_count;
+
+  uint8_t* region_data = g_data.mapped_data + g_data.data_region_index * g_data.data_region_size;
+  Im3d::GetContext().setVertexArena(
+      reinterpret_cast<Im3d::VertexData*>(region_data),
+      g_data.data_region_size / sizeof(Im3d::VertexData));
+}
+
+static uint64_t hash_round(uint64_t hash, uint64_t input) {
+  hash += input * 0xC2B2AE3D27D4EB4Full;
+  hash  = (hash << 31) | (hash >> 33);
+  return hash * 0x9E3779B185EBCA87ull;
+}
+
+// Hashes the position, size and color of each vertex, the VertexData padding is uninitialized.
+static uint64_t hash_vertex_data(const Im3d::VertexData* vertex_data, uint32_t vertex_count) {
+  uint64_t lanes[3] = {0x9E3779B185EBCA87ull, 0xC2B2AE3D27D4EB4Full, vertex_count};
+  for (uint32_t i = 0; i < vertex_count; i++) {
+    uint64_t position_size[2];
+    SDL_memcpy(position_size, &vertex_data[i].m_positionSize, sizeof(position_size));
+    lanes[0] = hash_round(lanes[0], position_size[0]);
+    lanes[1] = hash_round(lanes[1], position_size[1]);
+    lanes[2] = hash_round(lanes[2], vertex_data[i].m_color.v);
+  }
+  uint64_t hash  = hash_round(hash_round(lanes[0], lanes[1]), lanes[2]);
+  hash          ^= hash >> 29;
+  return hash;
+}
+
+// Hashes the text 8 bytes at a time along with its flags, never 0 which marks an empty text run.
+static uint64_t hash_text(const char* text, uint32_t text_length, uint32_t flags) {
+  uint64_t hash = hash_round(0x9E3779B185EBCA87ull, uint64_t(text_length) << 32 | flags);
+  uint32_t i    = 0;
+  for (; i + 8 <= text_length; i += 8) {
+    uint64_t chunk;
+    SDL_memcpy(&chunk, text + i, 8);
+    hash = hash_round(hash, chunk);
+  }
+  if (i < text_length) {
+    uint64_t chunk = 0;
+    SDL_memcpy(&chunk, text + i, text_length - i);
+    hash = hash_round(hash, chunk);
+  }
+  hash ^= hash >> 29;
+  return hash != 0 ? hash : 1;
+}
+
+static Layer_Info* find_layer_info(Im3d::Id layer_id) {
+  for (uint32_t i = 0; i < g_data.layer_info_count; i++) {
+    if (g_data.layer_infos[i].layer_id == layer_id) { return &g_data.layer_infos[i]; }
+  }
+  return nullptr;
+}
+
+// A layer without draw lists this frame forgets its generation, and its entry once it has no other
+// setting, so the layers of removed objects don't pile up.
+static void prune_layer_infos() {
+  uint32_t layer_info_count = 0;
+  for (uint32_t i = 0; i < g_data.layer_info_count; i++) {
+    Layer_Info& layer_info = g_data.layer_infos[i];
+    if (layer_info.seen_frame != g_data.frame_index) {
+      layer_info.has_generation = false;
+      if (!layer_info.has_reorderable &&
+          layer_info.depth_mode == IM3D_SDL3_GPU_DEPTH_MODE_DEFAULT) {
+        continue;
       }
+    }
+    g_data.layer_infos[layer_info_count++] = layer_info;
+  }
+  g_data.layer_info_count = layer_info_count;
+}
 
-      SDL_ReleaseGPUShader(g_data.init_info.device, vertex_shader);
-      SDL_ReleaseGPUShader(g_data.init_info.device, fragment_shader);
+static Layer_Info* get_layer_info(Im3d::Id layer_id) {
+  Layer_Info* layer_info = find_layer_info(layer_id);
+  if (layer_info != nullptr) { return layer_info; }
+
+  auto layer_infos = static_cast<Layer_Info*>(
+      SDL_realloc(g_data.layer_infos, (g_data.layer_info_count + 1) * sizeof(Layer_Info)));
+  if (layer_infos == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate layer infos");
+    return nullptr;
+  }
+  g_data.layer_infos  = layer_infos;
+  layer_info          = &g_data.layer_infos[g_data.layer_info_count++];
+  *layer_info         = {};
+  layer_info->layer_id = layer_id;
+  return layer_info;
+}
+
+// The depth mode of the current Im3d layer, for records submitted outside of Im3d's draw lists.
+static Im3d_SDL3_GPU_Depth_Mode current_depth_mode() {
+  const Layer_Info* layer_info = find_layer_info(Im3d::GetLayerId());
+  return layer_info != nullptr ? layer_info->depth_mode : IM3D_SDL3_GPU_DEPTH_MODE_DEFAULT;
+}
+
+// Adds count records from first in the current depth mode, extending the last run when it can.
+static Depth_Run* push_depth_run(Depth_Runs& runs, uint32_t first, uint32_t count) {
+  Im3d_SDL3_GPU_Depth_Mode depth_mode = current_depth_mode();
+  if (runs.count > 0) {
+    Depth_Run& run = runs.runs[runs.count - 1];
+    if (run.depth_mode == depth_mode && run.first + run.count == first) {
+      run.count += count;
+      return &run;
+    }
+  }
+  if (runs.count == runs.capacity) {
+    uint32_t capacity = SDL_max(runs.capacity * 2, 4u);
+    auto     depth_runs =
+        static_cast<Depth_Run*>(SDL_realloc(runs.runs, capacity * sizeof(Depth_Run)));
+    if (depth_runs == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate depth runs");
+      return nullptr;
+    }
+    runs.runs     = depth_runs;
+    runs.capacity = capacity;
+  }
+  Depth_Run& run = runs.runs[runs.count++];
+  run            = {};
+  run.depth_mode = depth_mode;
+  run.first      = first;
+  run.count      = count;
+  return &run;
+}
+
+// Hands the recorded runs over to be drawn, recording starts again in the other list.
+static void swap_depth_runs(Depth_Runs& runs, Depth_Runs& draw_runs) {
+  Depth_Runs swapped = draw_runs;
+  draw_runs          = runs;
+  runs               = swapped;
+  runs.count         = 0;
+}
+
+static void release_depth_runs(Depth_Runs& runs) {
+  SDL_free(runs.runs);
+  runs = {};
+}
+
+// Render targets without depth draw every depth state as DEPTH_STATE_OFF, see graphics_pipeline.
+static Depth_State depth_state(Im3d_SDL3_GPU_Depth_Mode depth_mode, bool filled) {
+  switch (depth_mode) {
+  case IM3D_SDL3_GPU_DEPTH_MODE_OFF:
+    return DEPTH_STATE_OFF;
+  case IM3D_SDL3_GPU_DEPTH_MODE_TEST:
+    return DEPTH_STATE_TEST;
+  case IM3D_SDL3_GPU_DEPTH_MODE_TEST_WRITE:
+    return DEPTH_STATE_TEST_WRITE;
+  default:
+    return filled ? DEPTH_STATE_TEST_WRITE : DEPTH_STATE_TEST;
+  }
+}
+
+// FNV-1a, matches hash_shader_code in shaders_to_c_arrays.cpp.
+static uint64_t hash_shader_code(const uint8_t* data, uint32_t size) {
+  uint64_t hash = 0xCBF29CE484222325ull;
+  for (uint32_t i = 0; i < size; i++) {
+    hash ^= data[i];
+    hash *= 0x100000001B3ull;
+  }
+  return hash;
+}
+
+// Adds the extension bytes of an LZ4 length to length, false when the input ends first.
+static bool read_lz4_length(const uint8_t*& in, const uint8_t* in_end, uint32_t& length) {
+  uint8_t byte;
+  do {
+    if (in == in_end) { return false; }
+    byte    = *in++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+// Decodes an LZ4 block of shaders_to_c_arrays --compress. False unless it decodes to exactly size
+// bytes without reading or writing out of bounds.
+static bool decompress_shader(
+    const uint8_t* packed,
+    uint32_t       packed_size,
+    uint8_t*       data,
+    uint32_t       size) {
+  const uint8_t* in      = packed;
+  const uint8_t* in_end  = packed + packed_size;
+  uint8_t*       out     = data;
+  uint8_t*       out_end = data + size;
+  while (in < in_end) {
+    uint8_t  token          = *in++;
+    uint32_t literal_length = token >> 4;
+    if (literal_length == 15 && !read_lz4_length(in, in_end, literal_length)) { return false; }
+    if (literal_length > uint32_t(in_end - in) || literal_length > uint32_t(out_end - out)) {
+      return false;
+    }
+    SDL_memcpy(out, in, literal_length);
+    in  += literal_length;
+    out += literal_length;
+
+    // The last sequence only has literals.
+    if (in == in_end) { break; }
+    if (in_end - in < 2) { return false; }
+    uint32_t offset        = in[0] | uint32_t(in[1]) << 8;
+    uint32_t match_length  = token & 15;
+    in                    += 2;
+    if (match_length == 15 && !read_lz4_length(in, in_end, match_length)) { return false; }
+    match_length += 4;
+    if (offset == 0 || offset > uint32_t(out - data) || match_length > uint32_t(out_end - out)) {
+      return false;
+    }
+    // Matches may overlap the bytes they copy.
+    const uint8_t* match = out - offset;
+    for (uint32_t i = 0; i < match_length; i++) {
+      out[i] = match[i];
+    }
+    out += match_length;
+  }
+  return out == out_end;
+}
+
+// Finds the shader name in the shader pack, decompressed into code.unpacked when it is stored
+// compressed. The caller frees code.unpacked.
+static bool load_shader(const char* name, Shader_Code& code) {
+  const Shader_Pack& pack  = g_data.shader_pack;
+  uint32_t           first = 0;
+  uint32_t           last  = pack.entry_count;
+  while (first < last) {
+    uint32_t middle = (first + last) / 2;
+    if (SDL_strcmp(pack.entries[middle].name, name) < 0) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  if (first == pack.entry_count || SDL_strcmp(pack.entries[first].name, name) != 0) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to find %s shader, im3d_sdl3_gpu_shaders.h may be out of date",
+        name);
+    return false;
+  }
+
+  const Im3d_SDL3_GPU_Shader_Entry& entry = pack.entries[first];
+  code                                    = {};
+  code.data                               = pack.data + entry.offset;
+  code.size                               = entry.size;
+  if (entry.packed_size == entry.size) { return true; }
+
+  code.unpacked = static_cast<uint8_t*>(SDL_malloc(entry.size));
+  if (code.unpacked == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate %s shader", name);
+    return false;
+  }
+  if (!decompress_shader(code.data, entry.packed_size, code.unpacked, entry.size) ||
+      hash_shader_code(code.unpacked, entry.size) != entry.hash) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to decompress %s shader", name);
+    SDL_free(code.unpacked);
+    code.unpacked = nullptr;
+    return false;
+  }
+  code.data = code.unpacked;
+  return true;
+}
+
+// Creates the pipelines of kind for a render target, one per depth state when it has depth. Nearer
+// or equal fragments pass, so lines stay visible on the faces they outline. The overlay pipeline
+// draws into the render pass of render_draw_data, its colors are premultiplied and it never tests
+// depth.
+static bool create_graphics_pipelines(
+    Target_Pipelines&      target_pipelines,
+    Graphics_Pipeline_Kind kind) {
+  const Im3d_SDL3_GPU_Render_Target& target  = target_pipelines.target;
+  const Graphics_Pipeline_Desc&      desc    = g_data.graphics_pipeline_descs[kind];
+  bool                               overlay = kind == GRAPHICS_PIPELINE_OVERLAY;
+
+  SDL_GPUShader* vertex_shader;
+  {
+    Shader_Code code;
+    if (!load_shader(desc.vertex_shader, code)) { return false; }
+
+    SDL_GPUShaderCreateInfo info = {};
+    info.code                    = code.data;
+    info.code_size               = code.size;
+    info.entrypoint              = "main";
+    info.format                  = g_data.shader_format;
+    info.num_storage_buffers     = overlay ? 0 : 3;
+    info.num_uniform_buffers     = 1;
+    info.stage                   = SDL_GPU_SHADERSTAGE_VERTEX;
+    vertex_shader                = SDL_CreateGPUShader(g_data.init_info.device, &info);
+    SDL_free(code.unpacked);
+    if (vertex_shader == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create %s vertex shader: %s",
+          desc.name,
+          SDL_GetError());
+      return false;
     }
+  }
+
+  SDL_GPUShader* fragment_shader;
+  {
+    Shader_Code code;
+    if (!load_shader(desc.fragment_shader, code)) {
+      SDL_ReleaseGPUShader(g_data.init_info.device, vertex_shader);
+      return false;
+    }
+
+    SDL_GPUShaderCreateInfo info = {};
+    info.code                    = code.data;
+    info.code_size               = code.size;
+    info.entrypoint              = "main";
+    info.format                  = g_data.shader_format;
+    info.num_samplers            = desc.fragment_sampler ? 1 : 0;
+    info.stage                   = SDL_GPU_SHADERSTAGE_FRAGMENT;
+    fragment_shader              = SDL_CreateGPUShader(g_data.init_info.device, &info);
+    SDL_free(code.unpacked);
+    if (fragment_shader == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create %s fragment shader: %s",
+          desc.name,
+          SDL_GetError());
+      SDL_ReleaseGPUShader(g_data.init_info.device, vertex_shader);
+      return false;
+    }
+  }
+
+  SDL_GPUColorTargetDescription color_target_desc     = {};
+  color_target_desc.format                            = target.color_format;
+  color_target_desc.blend_state.enable_blend          = true;
+  color_target_desc.blend_state.color_blend_op        = SDL_GPU_BLENDOP_ADD;
+  color_target_desc.blend_state.alpha_blend_op        = SDL_GPU_BLENDOP_ADD;
+  color_target_desc.blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
+  color_target_desc.blend_state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+  color_target_desc.blend_state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+  color_target_desc.blend_state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ZERO;
+  color_target_desc.blend_state.color_write_mask =
+      SDL_GPU_COLORCOMPONENT_R | SDL_GPU_COLORCOMPONENT_G | SDL_GPU_COLORCOMPONENT_B |
+      SDL_GPU_COLORCOMPONENT_A;
+  switch (target.blend_mode) {
+  case IM3D_SDL3_GPU_BLEND_MODE_PREMULTIPLIED:
+    color_target_desc.blend_state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+    color_target_desc.blend_state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE_MINUS_SRC_ALPHA;
+    break;
+  case IM3D_SDL3_GPU_BLEND_MODE_ADDITIVE:
+    color_target_desc.blend_state.dst_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+    color_target_desc.blend_state.src_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ZERO;
+    color_target_desc.blend_state.dst_alpha_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+    break;
+  default:
+    break;
+  }
+  if (overlay) {
+    color_target_desc.blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_ONE;
+  }
+
+  SDL_GPUVertexBufferDescription vertex_buffer_desc = {};
+  vertex_buffer_desc.slot                           = 0;
+  vertex_buffer_desc.pitch                          = sizeof(Im3d::Vec4);
+  vertex_buffer_desc.input_rate                     = SDL_GPU_VERTEXINPUTRATE_VERTEX;
+
+  SDL_GPUVertexAttribute vertex_attribute = {};
+  vertex_attribute.location               = 0;
+  vertex_attribute.buffer_slot            = 0;
+  vertex_attribute.format                 = SDL_GPU_VERTEXELEMENTFORMAT_FLOAT4;
+
+  SDL_GPUGraphicsPipelineCreateInfo info = {};
+  if (desc.vertex_input) {
+    info.vertex_input_state.num_vertex_buffers         = 1;
+    info.vertex_input_state.vertex_buffer_descriptions = &vertex_buffer_desc;
+    info.vertex_input_state.num_vertex_attributes      = 1;
+    info.vertex_input_state.vertex_attributes          = &vertex_attribute;
+  }
+  info.vertex_shader                         = vertex_shader;
+  info.fragment_shader                       = fragment_shader;
+  info.primitive_type                        = desc.primitive_type;
+  info.multisample_state.sample_count        = target.sample_count;
+  info.target_info.num_color_targets         = 1;
+  info.target_info.color_target_descriptions = &color_target_desc;
+
+  SDL_GPUGraphicsPipeline** pipelines = target_pipelines.pipelines[kind];
+  bool     has_depth   = target.depth_stencil_format != SDL_GPU_TEXTUREFORMAT_INVALID;
+  uint32_t state_count = has_depth && !overlay ? DEPTH_STATE_COUNT : 1;
+  bool     created     = true;
+  for (uint32_t i = 0; i < state_count && created; i++) {
+    SDL_GPUGraphicsPipelineCreateInfo variant_info      = info;
+    variant_info.target_info.has_depth_stencil_target   = has_depth;
+    variant_info.target_info.depth_stencil_format       = target.depth_stencil_format;
+    variant_info.depth_stencil_state.enable_depth_test  = i != DEPTH_STATE_OFF;
+    variant_info.depth_stencil_state.enable_depth_write = i == DEPTH_STATE_TEST_WRITE;
+    variant_info.depth_stencil_state.compare_op         = SDL_GPU_COMPAREOP_LESS_OR_EQUAL;
+
+    pipelines[i] = SDL_CreateGPUGraphicsPipeline(g_data.init_info.device, &variant_info);
+    if (pipelines[i] == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create %s pipeline: %s",
+          desc.name,
+          SDL_GetError());
+      created = false;
+    }
+  }
+
+  SDL_ReleaseGPUShader(g_data.init_info.device, vertex_shader);
+  SDL_ReleaseGPUShader(g_data.init_info.device, fragment_shader);
+  return created;
+}
+
+static uint64_t render_target_key(const Im3d_SDL3_GPU_Render_Target& target) {
+  return uint64_t(target.color_format) | uint64_t(target.sample_count) << 16 |
+         uint64_t(target.depth_stencil_format) << 24 | uint64_t(target.blend_mode) << 40;
+}
+
+// Returns the pipelines of target, adding them the first time it is drawn into. The table is at
+// most half full, so a lookup takes a probe or two however many targets are drawn into. Returns
+// null once MAX_RENDER_TARGETS configurations have been drawn into.
+static Target_Pipelines* find_target_pipelines(const Im3d_SDL3_GPU_Render_Target& target) {
+  uint64_t key  = render_target_key(target);
+  uint32_t slot = uint32_t(hash_round(0, key) >> 32) & (RENDER_TARGET_SLOT_COUNT - 1);
+  while (g_data.target_pipeline_slots[slot] != 0) {
+    Target_Pipelines& target_pipelines =
+        g_data.target_pipelines[g_data.target_pipeline_slots[slot] - 1];
+    if (target_pipelines.key == key) { return &target_pipelines; }
+    slot = (slot + 1) & (RENDER_TARGET_SLOT_COUNT - 1);
+  }
+
+  if (g_data.target_pipeline_count == MAX_RENDER_TARGETS) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Too many render target configurations");
+    return nullptr;
+  }
+  Target_Pipelines& target_pipelines = g_data.target_pipelines[g_data.target_pipeline_count++];
+  target_pipelines                   = {};
+  target_pipelines.key               = key;
+  target_pipelines.target            = target;
+  g_data.target_pipeline_slots[slot] = uint8_t(g_data.target_pipeline_count);
+  return &target_pipelines;
+}
+
+// Returns the pipeline of kind for depth_state, creating the kind's pipelines for the target the
+// first time. A kind which failed to be created is not retried, its draws are skipped.
+static SDL_GPUGraphicsPipeline* graphics_pipeline(
+    Target_Pipelines&      target_pipelines,
+    Graphics_Pipeline_Kind kind,
+    Depth_State            depth_state) {
+  SDL_GPUGraphicsPipeline** pipelines = target_pipelines.pipelines[kind];
+  if (pipelines[0] == nullptr && !target_pipelines.failed[kind]) {
+    if (!create_graphics_pipelines(target_pipelines, kind)) {
+      for (uint32_t i = 0; i < DEPTH_STATE_COUNT; i++) {
+        SDL_ReleaseGPUGraphicsPipeline(g_data.init_info.device, pipelines[i]);
+        pipelines[i] = nullptr;
+      }
+      target_pipelines.failed[kind] = true;
+      SDL_assert(false);
+    }
+  }
+  if (target_pipelines.target.depth_stencil_format == SDL_GPU_TEXTUREFORMAT_INVALID) {
+    depth_state = DEPTH_STATE_OFF;
+  }
+  return pipelines[depth_state];
+}
+
+// Returns the pipeline of kind, creating it the first time. A kind which failed to be created is
+// not retried.
+static SDL_GPUComputePipeline* compute_pipeline(Compute_Pipeline_Kind kind) {
+  if (g_data.compute_pipelines[kind] == nullptr && !g_data.compute_pipeline_failed[kind]) {
+    const Compute_Pipeline_Desc& desc = g_data.compute_pipeline_descs[kind];
+
+    Shader_Code code;
+    if (!load_shader(desc.shader, code)) {
+      g_data.compute_pipeline_failed[kind] = true;
+      SDL_assert(false);
+      return nullptr;
+    }
+
+    SDL_GPUComputePipelineCreateInfo info = {};
+    info.code                             = code.data;
+    info.code_size                        = code.size;
+    info.entrypoint                       = "main";
+    info.format                           = g_data.shader_format;
+    info.num_readonly_storage_buffers     = desc.readonly_storage_buffer_count;
+    info.num_readwrite_storage_buffers    = 1;
+    info.num_uniform_buffers              = 1;
+    info.threadcount_x                    = desc.thread_count;
+    info.threadcount_y                    = 1;
+    info.threadcount_z                    = 1;
+    g_data.compute_pipelines[kind] = SDL_CreateGPUComputePipeline(g_data.init_info.device, &info);
+    SDL_free(code.unpacked);
+    if (g_data.compute_pipelines[kind] == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create %s pipeline: %s",
+          desc.name,
+          SDL_GetError());
+      g_data.compute_pipeline_failed[kind] = true;
+      SDL_assert(false);
+    }
+  }
+  return g_data.compute_pipelines[kind];
+}
+
+static bool is_layer_reorderable(Im3d::Id layer_id) {
+  const Layer_Info* layer_info = find_layer_info(layer_id);
+  if (layer_info != nullptr && layer_info->has_reorderable) { return layer_info->reorderable; }
+  return g_data.init_info.reorder_draw_lists;
+}
+
+static void evict_resident_draw_list(Draw_List_Info& info) {
+  if (info.resident) {
+    g_data.resident_live_size -= info.fingerprint_vertex_count * g_data.vertex_stride;
+    info.resident              = false;
+  }
+}
+
+// Makes room for promote_size more bytes in the resident buffer. When the space past the last
+// allocation runs out, a new buffer is created and the live draw lists are compacted into it by
+// update_resident_buffer, so no range an in-flight frame may be reading is ever overwritten.
+static bool reserve_resident_buffer(uint64_t promote_size) {
+  if (promote_size == 0) { return true; }
+  if (g_data.resident_size + promote_size <= g_data.resident_capacity) { return true; }
+  if (g_data.retired_resident_buffer != nullptr) { return false; }
+
+  float growth_factor = g_data.init_info.buffer_growth_factor > 1.0f
+                            ? g_data.init_info.buffer_growth_factor
+                            : DEFAULT_BUFFER_GROWTH_FACTOR;
+
+  uint64_t required_size = g_data.resident_live_size + promote_size;
+  uint64_t capacity      = uint64_t(required_size * growth_factor);
+
+  capacity = SDL_max(capacity, uint64_t(MIN_DATA_REGION_SIZE));
+  capacity = (capacity + DATA_REGION_ALIGNMENT - 1) & ~uint64_t(DATA_REGION_ALIGNMENT - 1);
+  uint64_t other_bytes = g_data.memory_stats.current_bytes - g_data.resident_capacity;
+  if (g_data.init_info.memory_budget > 0 && other_bytes + capacity > g_data.init_info.memory_budget) {
+    capacity = required_size;
+  }
+  if (!within_memory_budget(int64_t(capacity) - int64_t(g_data.resident_capacity), "resident")) {
+    return false;
+  }
+  if (capacity > SDL_MAX_UINT32) { return false; }
+
+  SDL_GPUBufferCreateInfo info = {};
+  info.size                    = uint32_t(capacity);
+  info.usage                   = storage_buffer_usage();
+  SDL_GPUBuffer* buffer        = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+  if (buffer == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to create resident buffer: %s",
+        SDL_GetError());
+    return false;
+  }
+  track_memory(int64_t(capacity) - int64_t(g_data.resident_capacity));
+
+  g_data.retired_resident_buffer = g_data.resident_buffer;
+  g_data.resident_buffer         = buffer;
+  g_data.resident_capacity       = uint32_t(capacity);
+  return true;
+}
+
+// Compacts the live draw lists into a newly reserved resident buffer and copies the promoted draw
+// lists from where they were uploaded last frame, that data region is not reused before the copy.
+static void update_resident_buffer(SDL_GPUCopyPass* copy_pass) {
+  if (g_data.retired_resident_buffer != nullptr) {
+    uint32_t resident_size = 0;
+    for (uint32_t i = 0; i < g_data.draw_list_info_count; i++) {
+      Draw_List_Info& info = g_data.draw_list_infos[i];
+      if (!info.resident) { continue; }
+
+      SDL_GPUBufferLocation source = {};
+      source.buffer                = g_data.retired_resident_buffer;
+      source.offset                = info.resident_offset;
+
+      SDL_GPUBufferLocation destination = {};
+      destination.buffer                = g_data.resident_buffer;
+      destination.offset                = resident_size;
+
+      uint32_t size = info.fingerprint_vertex_count * g_data.vertex_stride;
+      SDL_CopyGPUBufferToBuffer(copy_pass, &source, &destination, size, false);
+      info.resident_offset  = resident_size;
+      resident_size        += size;
+    }
+    SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.retired_resident_buffer);
+    g_data.retired_resident_buffer = nullptr;
+    g_data.resident_size           = resident_size;
+  }
+
+  for (uint32_t i = 0; i < g_data.draw_list_info_count; i++) {
+    Draw_List_Info& info = g_data.draw_list_infos[i];
+    if (!info.promote) { continue; }
+
+    SDL_GPUBufferLocation source = {};
+    source.buffer                = g_data.data_buffer;
+    source.offset                = info.ring_offset;
+
+    SDL_GPUBufferLocation destination = {};
+    destination.buffer                = g_data.resident_buffer;
+    destination.offset                = g_data.resident_size;
+
+    uint32_t size = info.fingerprint_vertex_count * g_data.vertex_stride;
+    SDL_CopyGPUBufferToBuffer(copy_pass, &source, &destination, size, false);
+    info.resident_offset       = g_data.resident_size;
+    info.resident              = true;
+    info.promote               = false;
+    g_data.resident_size      += size;
+    g_data.resident_live_size += size;
+  }
+}
+
+static bool push_upload_range(uint32_t offset, uint32_t size) {
+  if (size == 0) { return true; }
+  if (g_data.upload_range_count == g_data.upload_range_capacity) {
+    uint32_t capacity      = SDL_max(16u, g_data.upload_range_capacity * 2);
+    auto     upload_ranges = static_cast<Upload_Range*>(
+        SDL_realloc(g_data.upload_ranges, capacity * sizeof(Upload_Range)));
+    if (upload_ranges == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate upload ranges");
+      return false;
+    }
+    g_data.upload_ranges         = upload_ranges;
+    g_data.upload_range_capacity = capacity;
+  }
+  g_data.upload_ranges[g_data.upload_range_count++] = {offset, size};
+  return true;
+}
+
+static int SDLCALL compare_upload_ranges(const void* a, const void* b) {
+  uint32_t offset_a = static_cast<const Upload_Range*>(a)->offset;
+  uint32_t offset_b = static_cast<const Upload_Range*>(b)->offset;
+  return offset_a < offset_b ? -1 : (offset_a > offset_b ? 1 : 0);
+}
+
+// Sorts the upload ranges and merges those separated by small gaps, a few wasted bytes are cheaper
+// than an extra copy command.
+static void merge_upload_ranges() {
+  if (g_data.upload_range_count < 2) { return; }
+  SDL_qsort(
+      g_data.upload_ranges,
+      g_data.upload_range_count,
+      sizeof(Upload_Range),
+      compare_upload_ranges);
+
+  uint32_t merged_count = 1;
+  for (uint32_t i = 1; i < g_data.upload_range_count; i++) {
+    Upload_Range&       last  = g_data.upload_ranges[merged_count - 1];
+    const Upload_Range& range = g_data.upload_ranges[i];
+    if (range.offset <= last.offset + last.size + UPLOAD_RANGE_MERGE_GAP) {
+      last.size = SDL_max(last.offset + last.size, range.offset + range.size) - last.offset;
+    } else {
+      g_data.upload_ranges[merged_count++] = range;
+    }
+  }
+  g_data.upload_range_count = merged_count;
+}
+
+// Returns the byte offset of draw_list within the region it was emitted into, or -1 if its vertices
+// live elsewhere.
+static int64_t emitted_offset(
+    const Im3d::DrawList& draw_list,
+    const uint8_t*        emission_data,
+    uint32_t              emission_size) {
+  auto vertex_data = reinterpret_cast<const uint8_t*>(draw_list.m_vertexData);
+  if (emission_data == nullptr) { return -1; }
+  if (vertex_data < emission_data || vertex_data >= emission_data + emission_size) { return -1; }
+  return vertex_data - emission_data;
+}
+
+static Retained_Layer* find_retained_layer(Im3d::Id layer_id) {
+  for (uint32_t i = 0; i < g_data.retained_layer_count; i++) {
+    if (g_data.retained_layers[i].layer_id == layer_id) { return &g_data.retained_layers[i]; }
+  }
+  return nullptr;
+}
+
+static void release_retained_upload_buffer(Retained_Layer& layer) {
+  if (layer.upload_buffer == nullptr) { return; }
+  SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, layer.upload_buffer);
+  track_memory(-int64_t(layer.buffer_size));
+  layer.upload_buffer = nullptr;
+}
+
+static void release_retained_layer(Retained_Layer& layer) {
+  release_retained_upload_buffer(layer);
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, layer.buffer);
+  SDL_free(layer.draws);
+  track_memory(-int64_t(layer.buffer_size));
+
+  layer.buffer      = nullptr;
+  layer.buffer_size = 0;
+  layer.draws       = nullptr;
+  layer.draw_count  = 0;
+}
+
+// Retained layers keep indexed triangles as plain triangles, which batch with their other draws.
+static uint32_t retained_vertex_count(const Im3d::DrawList& draw_list) {
+  if (draw_list.m_primType == Im3d::DrawPrimitive_IndexedTriangles) {
+    return fit_expanded_draw_list(draw_list, draw_list.m_indexCount);
+  }
+  return fit_draw_list(draw_list, draw_list.m_vertexCount);
+}
+
+// Copies this frame's draw lists of layer into a transfer buffer which the next copy pass uploads
+// to a buffer of its own, replacing the previous capture.
+static bool capture_retained_layer(Retained_Layer& layer) {
+  release_retained_layer(layer);
+  layer.capture_pending = false;
+
+  uint32_t draw_count   = 0;
+  uint32_t vertex_count = 0;
+  for (uint32_t i = 0; i < Im3d::GetDrawListCount(); i++) {
+    const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+    if (draw_list.m_layerId != layer.layer_id) { continue; }
+    draw_count++;
+    vertex_count += retained_vertex_count(draw_list);
+  }
+  if (vertex_count == 0) { return true; }
+
+  uint32_t buffer_size = vertex_count * g_data.vertex_stride;
+  if (!within_memory_budget(2 * int64_t(buffer_size), "retained layer")) { return false; }
+
+  layer.draws = static_cast<Retained_Draw*>(SDL_malloc(draw_count * sizeof(Retained_Draw)));
+  if (layer.draws == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate retained draws");
+    return false;
+  }
+
+  {
+    SDL_GPUBufferCreateInfo info = {};
+    info.size                    = buffer_size;
+    info.usage                   = storage_buffer_usage();
+    layer.buffer                 = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+    if (layer.buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create retained layer buffer: %s",
+          SDL_GetError());
+      return false;
+    }
+  }
+  {
+    SDL_GPUTransferBufferCreateInfo info = {};
+    info.size                            = buffer_size;
+    info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    layer.upload_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
+    if (layer.upload_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create transfer buffer: %s",
+          SDL_GetError());
+      return false;
+    }
+  }
+  layer.buffer_size = buffer_size;
+  track_memory(2 * int64_t(buffer_size));
+
+  auto mapped_data = static_cast<uint8_t*>(
+      SDL_MapGPUTransferBuffer(g_data.init_info.device, layer.upload_buffer, false));
+  if (mapped_data == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to map transfer buffer: %s",
+        SDL_GetError());
+    return false;
+  }
+  uint32_t vertex_offset = 0;
+  for (uint32_t i = 0; i < Im3d::GetDrawListCount(); i++) {
+    if (Im3d::GetDrawLists()[i].m_layerId != layer.layer_id) { continue; }
+
+    // Indexed triangles are expanded as they are written.
+    const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+    const uint32_t*       indices   = nullptr;
+    Retained_Draw&        draw      = layer.draws[layer.draw_count++];
+    draw.prim_type                  = draw_list.m_primType;
+    draw.vertex_offset              = vertex_offset;
+    draw.vertex_count               = retained_vertex_count(draw_list);
+    if (draw_list.m_primType == Im3d::DrawPrimitive_IndexedTriangles) {
+      indices        = draw_list.m_indexData;
+      draw.prim_type = Im3d::DrawPrimitive_Triangles;
+    }
+
+    uint8_t* dst = mapped_data + vertex_offset * g_data.vertex_stride;
+    if (g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_PACKED) {
+      Draw_List_Info info = {};
+      pack_draw_list(
+          draw_list,
+          draw.vertex_count,
+          reinterpret_cast<Packed_Vertex_Data*>(dst),
+          &info,
+          indices);
+      draw.position_origin = info.position_origin;
+      draw.position_scale  = info.position_scale;
+    } else if (indices != nullptr) {
+      auto vertices = reinterpret_cast<Im3d::VertexData*>(dst);
+      for (uint32_t j = 0; j < draw.vertex_count; j++) {
+        vertices[j] = draw_list.m_vertexData[indices[j]];
+      }
+    } else {
+      SDL_memcpy(dst, draw_list.m_vertexData, draw.vertex_count * sizeof(Im3d::VertexData));
+    }
+    vertex_offset += draw.vertex_count;
+  }
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, layer.upload_buffer);
+  return true;
+}
+
+// The draw buffer holds the segments followed by the indirect draw commands of each batch, with one
+// region per data region.
+static uint32_t draw_region_size(uint32_t draw_capacity) {
+  uint32_t size = draw_capacity * (sizeof(Draw_Segment) + sizeof(SDL_GPUIndirectDrawCommand));
+  return (size + DATA_REGION_ALIGNMENT - 1) & ~(DATA_REGION_ALIGNMENT - 1);
+}
+
+static bool reserve_draw_buffers(uint32_t draw_count) {
+  if (draw_count <= g_data.draw_capacity) { return true; }
+
+  uint32_t draw_capacity = SDL_max(draw_count, g_data.draw_capacity * 2);
+  draw_capacity          = SDL_max(draw_capacity, MIN_DRAW_CAPACITY);
+  uint32_t buffer_size   = draw_region_size(draw_capacity) * g_data.data_region_count;
+
+  int64_t size_old = 2 * int64_t(draw_region_size(g_data.draw_capacity)) * g_data.data_region_count;
+  if (g_data.draw_capacity == 0) { size_old = 0; }
+  if (!within_memory_budget(2 * int64_t(buffer_size) - size_old, "draw")) { return false; }
+
+  SDL_GPUBuffer* draw_buffer;
+  {
+    SDL_GPUBufferCreateInfo info = {};
+    info.size                    = buffer_size;
+    info.usage                   = SDL_GPU_BUFFERUSAGE_INDIRECT | storage_buffer_usage();
+    draw_buffer                  = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+    if (draw_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create draw buffer: %s",
+          SDL_GetError());
+      return false;
+    }
+  }
+  SDL_GPUTransferBuffer* draw_transfer_buffer;
+  {
+    SDL_GPUTransferBufferCreateInfo info = {};
+    info.size                            = buffer_size;
+    info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    draw_transfer_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
+    if (draw_transfer_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create transfer buffer: %s",
+          SDL_GetError());
+      SDL_ReleaseGPUBuffer(g_data.init_info.device, draw_buffer);
+      return false;
+    }
+  }
+
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.draw_buffer);
+  SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.draw_transfer_buffer);
+
+  track_memory(2 * int64_t(buffer_size) - size_old);
+
+  g_data.draw_buffer          = draw_buffer;
+  g_data.draw_transfer_buffer = draw_transfer_buffer;
+  g_data.draw_capacity        = draw_capacity;
+  return true;
+}
+
+// The cull buffer holds the indirect draw commands of the batches followed by the visible instance
+// indices of the culled batches, with one region per data region.
+static uint32_t cull_region_size() {
+  uint32_t size = g_data.cull_draw_capacity * sizeof(SDL_GPUIndirectDrawCommand) +
+                  g_data.cull_instance_capacity * sizeof(uint32_t);
+  return (size + DATA_REGION_ALIGNMENT - 1) & ~(DATA_REGION_ALIGNMENT - 1);
+}
+
+static bool reserve_cull_buffer(uint32_t instance_count) {
+  if (g_data.cull_buffer != nullptr && g_data.cull_draw_capacity == g_data.draw_capacity &&
+      instance_count <= g_data.cull_instance_capacity) {
+    return true;
+  }
+
+  uint32_t old_size          = g_data.cull_buffer != nullptr ? cull_region_size() : 0;
+  uint32_t draw_capacity     = g_data.cull_draw_capacity;
+  uint32_t instance_capacity = g_data.cull_instance_capacity;
+  g_data.cull_draw_capacity     = g_data.draw_capacity;
+  g_data.cull_instance_capacity = SDL_max(g_data.cull_instance_capacity, MIN_CULL_CAPACITY);
+  while (g_data.cull_instance_capacity < instance_count) { g_data.cull_instance_capacity *= 2; }
+  uint32_t buffer_size = cull_region_size() * g_data.data_region_count;
+  if (!within_memory_budget(
+          int64_t(buffer_size) - int64_t(old_size) * g_data.data_region_count,
+          "cull")) {
+    g_data.cull_draw_capacity     = draw_capacity;
+    g_data.cull_instance_capacity = instance_capacity;
+    return false;
+  }
+
+  SDL_GPUBufferCreateInfo info = {};
+  info.size                    = buffer_size;
+  info.usage = SDL_GPU_BUFFERUSAGE_INDIRECT | SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ |
+               SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ |
+               SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE;
+  SDL_GPUBuffer* cull_buffer = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+  if (cull_buffer == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to create cull buffer: %s",
+        SDL_GetError());
+    g_data.cull_draw_capacity     = draw_capacity;
+    g_data.cull_instance_capacity = instance_capacity;
+    return false;
+  }
+
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.cull_buffer);
+  track_memory(int64_t(buffer_size) - int64_t(old_size) * g_data.data_region_count);
+  g_data.cull_buffer = cull_buffer;
+  return true;
+}
+
+// The sort buffer holds the two key and value arrays and the count array of the sort passes, each
+// with sort_capacity elements, with one region per data region.
+static uint32_t sort_region_size() {
+  return g_data.sort_capacity * 5 * sizeof(uint32_t);
+}
+
+static bool reserve_sort_buffer(uint32_t instance_count) {
+  if (g_data.sort_buffer != nullptr && instance_count <= g_data.sort_capacity) { return true; }
+
+  uint32_t old_size = g_data.sort_buffer != nullptr ? sort_region_size() : 0;
+  uint32_t capacity = SDL_max(g_data.sort_capacity, MIN_SORT_CAPACITY);
+  while (capacity < instance_count) { capacity *= 2; }
+
+  uint32_t buffer_size = capacity * 5 * sizeof(uint32_t) * g_data.data_region_count;
+  if (!within_memory_budget(
+          int64_t(buffer_size) - int64_t(old_size) * g_data.data_region_count,
+          "sort")) {
+    return false;
+  }
+
+  SDL_GPUBufferUsageFlags usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ |
+                                  SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE;
+
+  SDL_GPUBufferCreateInfo info = {};
+  info.size                    = buffer_size;
+  info.usage                   = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ | usage;
+  SDL_GPUBuffer* sort_buffer = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+  if (sort_buffer == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to create sort buffer: %s",
+        SDL_GetError());
+    return false;
+  }
+
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.sort_buffer);
+  track_memory(int64_t(info.size) - int64_t(old_size) * g_data.data_region_count);
+  g_data.sort_buffer   = sort_buffer;
+  g_data.sort_capacity = capacity;
+  return true;
+}
+
+static uint32_t primitive_vertex_count(Im3d::DrawPrimitiveType prim_type) {
+  switch (prim_type) {
+  case Im3d::DrawPrimitive_Points:
+    return 1;
+  case Im3d::DrawPrimitive_Lines:
+  case Im3d::DrawPrimitive_LineStrip:
+    return 2;
+  default:
+    return 3;
+  }
+}
+
+// Strips are drawn with a primitive starting at every vertex but the last one or two, those which
+// would join two strips are degenerate, see is_strip_break in im3d_sdl3_gpu.hlsl.
+static uint32_t primitive_vertex_stride(Im3d::DrawPrimitiveType prim_type) {
+  switch (prim_type) {
+  case Im3d::DrawPrimitive_Lines:
+    return 2;
+  case Im3d::DrawPrimitive_Triangles:
+  case Im3d::DrawPrimitive_IndexedTriangles:
+    return 3;
+  default:
+    return 1;
+  }
+}
+
+// Unsorted filled primitives write depth unless their layer's depth mode says otherwise. Sorted
+// ones are drawn back to front, often translucent, and would hide what is drawn after them.
+static Depth_State layer_depth_state(
+    Im3d::Id                layer_id,
+    Im3d::DrawPrimitiveType prim_type,
+    bool                    sorted) {
+  const Layer_Info*        layer_info = find_layer_info(layer_id);
+  Im3d_SDL3_GPU_Depth_Mode depth_mode =
+      layer_info != nullptr ? layer_info->depth_mode : IM3D_SDL3_GPU_DEPTH_MODE_DEFAULT;
+  return depth_state(depth_mode, !sorted && primitive_vertex_count(prim_type) == 3);
+}
+
+static bool push_draw_segment(
+    Draw_Segment*           segments,
+    SDL_GPUBuffer*          vertex_data_buffer,
+    Im3d::DrawPrimitiveType prim_type,
+    Depth_State             depth_state,
+    uint32_t                vertex_offset,
+    uint32_t                vertex_count,
+    const Im3d::Vec3&       position_origin,
+    const Im3d::Vec3&       position_scale,
+    bool                    sorted) {
+  uint32_t vertex_stride  = primitive_vertex_stride(prim_type);
+  uint32_t extra_count    = primitive_vertex_count(prim_type) - vertex_stride;
+  uint32_t instance_count =
+      vertex_count > extra_count ? (vertex_count - extra_count) / vertex_stride : 0;
+  bool indexed = prim_type == Im3d::DrawPrimitive_IndexedTriangles;
+  if (indexed) { instance_count = vertex_count > 0 ? 1 : 0; }
+  if (instance_count == 0) { return true; }
+
+  Draw_Batch* batch = g_data.draw_batch_count > 0
+                          ? &g_data.draw_batches[g_data.draw_batch_count - 1]
+                          : nullptr;
+  // Sorted batches are sorted as a whole on the GPU, so they don't span draw lists from different
+  // layers, which Im3d sorts separately. Indexed triangles are drawn with their own index range.
+  if (batch == nullptr || indexed || batch->vertex_data_buffer != vertex_data_buffer ||
+      batch->prim_type != prim_type || batch->depth_state != depth_state ||
+      batch->sorted != sorted || (sorted && g_data.init_info.gpu_sorting)) {
+    if (g_data.draw_batch_count == g_data.draw_batch_capacity) {
+      uint32_t capacity     = SDL_max(MIN_DRAW_CAPACITY, g_data.draw_batch_capacity * 2);
+      auto     draw_batches = static_cast<Draw_Batch*>(
+          SDL_realloc(g_data.draw_batches, capacity * sizeof(Draw_Batch)));
+      if (draw_batches == nullptr) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate draw batches");
+        return false;
+      }
+      g_data.draw_batches        = draw_batches;
+      g_data.draw_batch_capacity = capacity;
+    }
+    batch                     = &g_data.draw_batches[g_data.draw_batch_count++];
+    batch->vertex_data_buffer = vertex_data_buffer;
+    batch->prim_type          = prim_type;
+    batch->depth_state        = depth_state;
+    batch->first_segment      = g_data.draw_segment_count;
+    batch->segment_count      = 0;
+    batch->instance_count     = 0;
+    batch->sorted             = sorted;
+    batch->culled             = false;
+    batch->visible_offset     = 0;
+    batch->gpu_sorted         = false;
+    batch->sort_offset        = 0;
+    batch->index_offset       = 0;
+    batch->index_count        = 0;
+    batch->index_16bit        = false;
+  } else if (
+      g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_FULL &&
+      batch->vertex_end == vertex_offset) {
+    // Strips gain the degenerate primitives which join the previous draw list to this one.
+    batch->instance_count += instance_count + extra_count;
+    batch->vertex_end     += vertex_count;
+    return true;
+  }
+
+  Draw_Segment& segment   = segments[g_data.draw_segment_count++];
+  segment.first_instance  = batch->instance_count;
+  segment.vertex_offset   = vertex_offset;
+  segment.position_origin = position_origin;
+  segment.position_scale  = position_scale;
+
+  batch->segment_count  += 1;
+  batch->instance_count += instance_count;
+  batch->vertex_end      = vertex_offset + vertex_count;
+  return true;
+}
+
+// Indexed lists are never resident, their indices change without their vertices. With the full
+// vertex format their indices start at the data region, see write_index_data, so a list whose
+// indices follow those of the previous batch extends its draw. The batch counts as one instance
+// and is drawn with SDL_DrawGPUIndexedPrimitives, so it isn't culled, sorted or drawn indirectly.
+// Lists expanded by expand_indexed_triangles are pushed as plain triangles instead.
+static bool push_indexed_draw(
+    Draw_Segment*         segments,
+    const Draw_List_Info& info,
+    Depth_State           depth_state,
+    uint32_t              data_vertex_offset) {
+  if (info.index_count == 0) { return true; }
+
+  bool        rebased      = g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_FULL;
+  uint32_t    element_size = info.index_16bit ? 2 : 4;
+  Draw_Batch* batch        = g_data.draw_batch_count > 0
+                                 ? &g_data.draw_batches[g_data.draw_batch_count - 1]
+                                 : nullptr;
+  if (rebased && batch != nullptr && batch->prim_type == Im3d::DrawPrimitive_IndexedTriangles &&
+      batch->vertex_data_buffer == g_data.data_buffer && batch->depth_state == depth_state &&
+      batch->index_16bit == info.index_16bit &&
+      batch->index_offset + batch->index_count * element_size == info.index_offset) {
+    batch->index_count += info.index_count;
+    return true;
+  }
+
+  uint32_t batch_count = g_data.draw_batch_count;
+  if (!push_draw_segment(
+          segments,
+          g_data.data_buffer,
+          Im3d::DrawPrimitive_IndexedTriangles,
+          depth_state,
+          data_vertex_offset + (rebased ? 0 : info.vertex_offset),
+          info.vertex_count,
+          info.position_origin,
+          info.position_scale,
+          false)) {
+    return false;
+  }
+  if (g_data.draw_batch_count > batch_count) {
+    batch               = &g_data.draw_batches[batch_count];
+    batch->index_offset = info.index_offset;
+    batch->index_count  = info.index_count;
+    batch->index_16bit  = info.index_16bit;
+  }
+  return true;
+}
+
+// Whether push_retained_layers draws a retained layer between draw lists of the layers at
+// layer_index_0 and layer_index_1, in Im3d's layer order.
+static bool has_retained_layer_between(int layer_index_0, int layer_index_1) {
+  for (uint32_t i = 0; i < g_data.retained_layer_count; i++) {
+    int layer_index = g_data.retained_layers[i].layer_index;
+    if (layer_index >= layer_index_0 && layer_index < layer_index_1) { return true; }
+  }
+  return false;
+}
+
+// Fills draw_order with the order in which the draw lists are batched. Runs of unsorted draw lists
+// from reorderable layers are grouped by primitive type, triangles first so that lines and points
+// stay on top of filled shapes, and then by vertex data buffer. Runs end where a retained layer is
+// drawn, so its lists can't be moved past it. Everything else keeps Im3d's order.
+static bool order_draw_lists() {
+  uint32_t draw_list_count = g_data.draw_list_info_count;
+  if (g_data.draw_order_capacity < draw_list_count) {
+    uint32_t capacity   = SDL_max(draw_list_count, g_data.draw_order_capacity * 2);
+    auto     draw_order = static_cast<uint32_t*>(
+        SDL_realloc(g_data.draw_order, capacity * sizeof(uint32_t)));
+    if (draw_order == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate draw order");
+      return false;
+    }
+    g_data.draw_order          = draw_order;
+    g_data.draw_order_capacity = capacity;
+  }
+
+  static constexpr Im3d::DrawPrimitiveType PRIM_TYPE_ORDER[] = {
+      Im3d::DrawPrimitive_Triangles,
+      Im3d::DrawPrimitive_TriangleStrip,
+      Im3d::DrawPrimitive_IndexedTriangles,
+      Im3d::DrawPrimitive_Lines,
+      Im3d::DrawPrimitive_LineStrip,
+      Im3d::DrawPrimitive_Points,
+  };
+
+  const Im3d::DrawList* draw_lists = Im3d::GetDrawLists();
+  uint32_t unsorted_count = SDL_min(Im3d::GetContext().getUnsortedDrawListCount(), draw_list_count);
+  uint32_t order_count    = 0;
+  for (uint32_t i = 0; i < draw_list_count;) {
+    if (i >= unsorted_count || !is_layer_reorderable(draw_lists[i].m_layerId)) {
+      g_data.draw_order[order_count++] = i++;
+      continue;
+    }
+
+    uint32_t run_end = i + 1;
+    while (run_end < unsorted_count && is_layer_reorderable(draw_lists[run_end].m_layerId)) {
+      int layer_index_0 = Im3d::GetContext().getLayerIndex(draw_lists[run_end - 1].m_layerId);
+      int layer_index_1 = Im3d::GetContext().getLayerIndex(draw_lists[run_end].m_layerId);
+      if (has_retained_layer_between(layer_index_0, layer_index_1)) { break; }
+      run_end++;
+    }
+    for (Im3d::DrawPrimitiveType prim_type : PRIM_TYPE_ORDER) {
+      for (int resident = 0; resident < 2; resident++) {
+        for (uint32_t j = i; j < run_end; j++) {
+          bool expanded = g_data.draw_list_infos[j].index_expanded;
+          if ((expanded ? Im3d::DrawPrimitive_Triangles : draw_lists[j].m_primType) != prim_type) {
+            continue;
+          }
+          if (g_data.draw_list_infos[j].resident != (resident != 0)) { continue; }
+          g_data.draw_order[order_count++] = j;
+        }
+      }
+    }
+    i = run_end;
+  }
+  SDL_assert(order_count == draw_list_count);
+  return true;
+}
+
+static int compare_retained_layers(const void* a, const void* b) {
+  int a_index = static_cast<const Retained_Layer*>(a)->layer_index;
+  int b_index = static_cast<const Retained_Layer*>(b)->layer_index;
+  return (a_index > b_index) - (a_index < b_index);
+}
+
+// Pushes the segments of the retained layers, sorted by layer_index, that come before layer_index.
+// retained_count is the number of layers already pushed.
+static bool push_retained_layers(
+    Draw_Segment* segments,
+    int           layer_index,
+    uint32_t&     retained_count) {
+  for (; retained_count < g_data.retained_layer_count; retained_count++) {
+    const Retained_Layer& layer = g_data.retained_layers[retained_count];
+    if (layer.layer_index >= layer_index) { break; }
+
+    for (uint32_t j = 0; j < layer.draw_count; j++) {
+      const Retained_Draw& draw = layer.draws[j];
+      bool                 succeeded = push_draw_segment(
+          segments,
+          layer.buffer,
+          draw.prim_type,
+          layer_depth_state(layer.layer_id, draw.prim_type, false),
+          draw.vertex_offset,
+          draw.vertex_count,
+          draw.position_origin,
+          draw.position_scale,
+          false);
+      if (!succeeded) { return false; }
+    }
+  }
+  return true;
+}
+
+// Groups the retained layers and this frame's draw lists into batches and writes their segments
+// and indirect draw commands to the current region of the draw buffer.
+static bool write_draw_batches() {
+  g_data.draw_batch_count   = 0;
+  g_data.draw_segment_count = 0;
+
+  const Im3d::AppData& app_data = Im3d::GetAppData();
+  if (app_data.m_viewportSize.x <= 0.0f || app_data.m_viewportSize.y <= 0.0f) { return false; }
+
+  uint32_t draw_count = g_data.total_vertex_count > 0 ? g_data.draw_list_info_count : 0;
+  for (uint32_t i = 0; i < g_data.retained_layer_count; i++) {
+    draw_count += g_data.retained_layers[i].draw_count;
+  }
+  if (draw_count == 0) { return false; }
+  if (!reserve_draw_buffers(draw_count)) { return false; }
+
+  uint32_t region_offset = g_data.data_region_index * draw_region_size(g_data.draw_capacity);
+  auto     mapped_data   = static_cast<uint8_t*>(
+      SDL_MapGPUTransferBuffer(g_data.init_info.device, g_data.draw_transfer_buffer, false));
+  if (mapped_data == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to map transfer buffer: %s",
+        SDL_GetError());
+    SDL_assert(false);
+    return false;
+  }
+  auto segments = reinterpret_cast<Draw_Segment*>(mapped_data + region_offset);
+
+  // Retained layers are drawn in Im3d's layer order among the unsorted draw lists, the sorted draw
+  // lists come after all of them.
+  for (uint32_t i = 0; i < g_data.retained_layer_count; i++) {
+    Retained_Layer& layer = g_data.retained_layers[i];
+    layer.layer_index     = Im3d::GetContext().getLayerIndex(layer.layer_id);
+  }
+  SDL_qsort(
+      g_data.retained_layers,
+      g_data.retained_layer_count,
+      sizeof(Retained_Layer),
+      compare_retained_layers);
+
+  bool     succeeded      = true;
+  uint32_t retained_count = 0;
+  if (g_data.total_vertex_count > 0) {
+    succeeded = order_draw_lists();
+
+    uint32_t data_vertex_offset =
+        g_data.data_region_index * g_data.data_region_size / g_data.vertex_stride;
+    uint32_t unsorted_count = Im3d::GetContext().getUnsortedDrawListCount();
+    for (uint32_t k = 0; k < g_data.draw_list_info_count && succeeded; k++) {
+      uint32_t              i         = g_data.draw_order[k];
+      const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+      const Draw_List_Info& info      = g_data.draw_list_infos[i];
+
+      int layer_index = SDL_MAX_SINT32;
+      if (i < unsorted_count) {
+        layer_index = Im3d::GetContext().getLayerIndex(draw_list.m_layerId);
+      }
+      succeeded &= push_retained_layers(segments, layer_index, retained_count);
+
+      SDL_GPUBuffer* buffer        = g_data.data_buffer;
+      uint32_t       vertex_offset = data_vertex_offset + info.vertex_offset;
+      if (info.resident) {
+        buffer        = g_data.resident_buffer;
+        vertex_offset = info.resident_offset / g_data.vertex_stride;
+      }
+      bool        sorted = i >= unsorted_count;
+      Depth_State depth_state =
+          layer_depth_state(draw_list.m_layerId, draw_list.m_primType, sorted);
+      if (draw_list.m_primType == Im3d::DrawPrimitive_IndexedTriangles && !info.index_expanded) {
+        succeeded &= push_indexed_draw(segments, info, depth_state, data_vertex_offset);
+        continue;
+      }
+      succeeded &= push_draw_segment(
+          segments,
+          buffer,
+          info.index_expanded ? Im3d::DrawPrimitive_Triangles : draw_list.m_primType,
+          depth_state,
+          vertex_offset,
+          info.vertex_count,
+          info.position_origin,
+          info.position_scale,
+          sorted);
+    }
+  }
+  if (succeeded) { succeeded = push_retained_layers(segments, SDL_MAX_SINT32, retained_count); }
+
+  // Culling appends the visible instances in no particular order, sorted batches would lose their
+  // back to front order.
+  g_data.cull_instance_count = 0;
+  for (uint32_t i = 0; i < g_data.draw_batch_count && succeeded; i++) {
+    Draw_Batch& batch = g_data.draw_batches[i];
+
+    batch.culled = g_data.init_info.gpu_culling && !batch.sorted &&
+                   batch.instance_count >= MIN_CULL_INSTANCE_COUNT;
+    if (!batch.culled) { continue; }
+    batch.visible_offset        = g_data.cull_instance_count;
+    g_data.cull_instance_count += batch.instance_count;
+  }
+  // Without a cull buffer the draws are fetched from the draw buffer and every instance is drawn.
+  g_data.cull_commands =
+      g_data.init_info.gpu_culling && reserve_cull_buffer(g_data.cull_instance_count);
+  if (!g_data.cull_commands) {
+    for (uint32_t i = 0; i < g_data.draw_batch_count; i++) { g_data.draw_batches[i].culled = false; }
+    g_data.cull_instance_count = 0;
+  }
+
+  // Each sorted batch's slice is padded to whole groups, the padding keys sort last. Batches are
+  // sorted on their own and drawn one after another, where the CPU sort would interleave sorted
+  // primitives of different types, which is warned about once.
+  g_data.sort_instance_count     = 0;
+  const Draw_Batch* first_sorted = nullptr;
+  for (uint32_t i = 0; i < g_data.draw_batch_count && succeeded; i++) {
+    Draw_Batch& batch       = g_data.draw_batches[i];
+    uint32_t    group_count = (batch.instance_count + SORT_GROUP_SIZE - 1) / SORT_GROUP_SIZE;
+
+    if (g_data.init_info.gpu_sorting && batch.sorted) {
+      if (first_sorted == nullptr) { first_sorted = &batch; }
+      if (first_sorted->prim_type != batch.prim_type && !g_data.sort_warning_logged) {
+        SDL_LogWarn(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "gpu_sorting doesn't order sorted primitives of different types against each other");
+        g_data.sort_warning_logged = true;
+      }
+    }
+
+    batch.gpu_sorted = g_data.init_info.gpu_sorting && batch.sorted && batch.instance_count > 1;
+    if (batch.gpu_sorted && group_count > MAX_SORT_GROUPS) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Too many sorted primitives, drawing unsorted");
+      batch.gpu_sorted = false;
+    }
+    if (!batch.gpu_sorted) { continue; }
+    batch.sort_offset           = g_data.sort_instance_count;
+    g_data.sort_instance_count += group_count * SORT_GROUP_SIZE;
+  }
+  // Without a sort buffer the sorted batches are drawn in submission order.
+  if (g_data.sort_instance_count > 0 && !reserve_sort_buffer(g_data.sort_instance_count)) {
+    for (uint32_t i = 0; i < g_data.draw_batch_count; i++) {
+      g_data.draw_batches[i].gpu_sorted = false;
+    }
+    g_data.sort_instance_count = 0;
+  }
+
+  auto commands = reinterpret_cast<SDL_GPUIndirectDrawCommand*>(
+      mapped_data + region_offset + g_data.draw_capacity * sizeof(Draw_Segment));
+  for (uint32_t i = 0; i < g_data.draw_batch_count && succeeded; i++) {
+    const Draw_Batch& batch   = g_data.draw_batches[i];
+    commands[i]               = {};
+    commands[i].num_vertices  = primitive_vertex_count(batch.prim_type) == 3 ? 3 : 4;
+    commands[i].num_instances = batch.culled ? 0 : batch.instance_count;
+  }
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.draw_transfer_buffer);
+
+  if (!succeeded) {
+    SDL_assert(false);
+    g_data.draw_batch_count = 0;
+  }
+  return g_data.draw_batch_count > 0;
+}
+
+// Fills in the uniforms which select the segments, visible instances and draw command of a batch.
+static void set_batch_uniforms(Vertex_Uniforms& uniforms, uint32_t batch_index) {
+  const Draw_Batch& batch = g_data.draw_batches[batch_index];
+
+  uint32_t draw_region_offset = g_data.data_region_index * draw_region_size(g_data.draw_capacity);
+  uint32_t cull_region_offset = g_data.data_region_index * cull_region_size();
+  uint32_t visible_offset =
+      cull_region_offset + g_data.cull_draw_capacity * sizeof(SDL_GPUIndirectDrawCommand);
+
+  // The sorted instance indices end up in the first value array.
+  uint32_t sort_offset = g_data.data_region_index * sort_region_size() / sizeof(uint32_t);
+
+  uniforms.segment_offset  = draw_region_offset / sizeof(Draw_Segment) + batch.first_segment;
+  uniforms.segment_count   = batch.segment_count;
+  uniforms.remap_instances = batch.culled || batch.gpu_sorted;
+  uniforms.instance_count  = batch.instance_count;
+  uniforms.sort_capacity   = g_data.sort_capacity;
+  if (batch.culled) {
+    uniforms.remap_offset = visible_offset / sizeof(uint32_t) + batch.visible_offset;
+  } else if (batch.gpu_sorted) {
+    uniforms.remap_offset = sort_offset + g_data.sort_capacity + batch.sort_offset;
+  }
+  uniforms.command_offset = cull_region_offset + batch_index * sizeof(SDL_GPUIndirectDrawCommand);
+
+  uniforms.primitive_vertex_count  = primitive_vertex_count(batch.prim_type);
+  uniforms.primitive_vertex_stride = primitive_vertex_stride(batch.prim_type);
+}
+
+// Appends the primitives of the culled batches which intersect the frustum to their visible
+// instance indices, counting them in the batch's draw command which was uploaded with no instances.
+static void cull_draw_batches(SDL_GPUCommandBuffer* command_buffer) {
+  SDL_GPUComputePipeline* pipeline = compute_pipeline(COMPUTE_PIPELINE_CULL);
+  if (pipeline == nullptr) { return; }
+
+  SDL_GPUStorageBufferReadWriteBinding binding = {};
+  binding.buffer                               = g_data.cull_buffer;
+  SDL_GPUComputePass* compute_pass =
+      SDL_BeginGPUComputePass(command_buffer, nullptr, 0, &binding, 1);
+  SDL_BindGPUComputePipeline(compute_pass, pipeline);
+
+  const Im3d::AppData& app_data    = Im3d::GetAppData();
+  Vertex_Uniforms      uniforms    = {};
+  uniforms.world_to_clip_transform = g_data.world_to_clip_transform;
+  uniforms.resolution              = app_data.m_viewportSize;
+  uniforms.vertex_packed = g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_PACKED;
+
+  SDL_GPUBuffer* bound_buffer = nullptr;
+  for (uint32_t i = 0; i < g_data.draw_batch_count; i++) {
+    const Draw_Batch& batch = g_data.draw_batches[i];
+    if (!batch.culled) { continue; }
+
+    if (batch.vertex_data_buffer != bound_buffer) {
+      SDL_GPUBuffer* storage_buffers[] = {batch.vertex_data_buffer, g_data.draw_buffer};
+      SDL_BindGPUComputeStorageBuffers(compute_pass, 0, storage_buffers, 2);
+      bound_buffer = batch.vertex_data_buffer;
+    }
+
+    set_batch_uniforms(uniforms, i);
+    SDL_PushGPUComputeUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+
+    uint32_t group_count = (batch.instance_count + CULL_THREAD_COUNT - 1) / CULL_THREAD_COUNT;
+    SDL_DispatchGPUCompute(
+        compute_pass,
+        SDL_min(group_count, CULL_GROUPS_PER_ROW),
+        (group_count + CULL_GROUPS_PER_ROW - 1) / CULL_GROUPS_PER_ROW,
+        1);
+  }
+  SDL_EndGPUComputePass(compute_pass);
+}
+
+// Sorts the instances of the sorted batches back to front, see the sort shaders in
+// im3d_sdl3_gpu.hlsl. Each step reads what the previous one wrote and dispatches within a compute
+// pass are not synchronized, so every step is a pass of its own covering all sorted batches.
+static void sort_draw_batches(SDL_GPUCommandBuffer* command_buffer) {
+  const Im3d::AppData& app_data    = Im3d::GetAppData();
+  Vertex_Uniforms      uniforms    = {};
+  uniforms.world_to_clip_transform = g_data.world_to_clip_transform;
+  uniforms.resolution              = app_data.m_viewportSize;
+  uniforms.view_origin             = app_data.m_viewOrigin;
+  uniforms.vertex_packed = g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_PACKED;
+
+  SDL_GPUComputePipeline* keys_pipeline    = compute_pipeline(COMPUTE_PIPELINE_SORT_KEYS);
+  SDL_GPUComputePipeline* pass_pipelines[] = {
+      compute_pipeline(COMPUTE_PIPELINE_SORT_COUNT),
+      compute_pipeline(COMPUTE_PIPELINE_SORT_SCAN),
+      compute_pipeline(COMPUTE_PIPELINE_SORT_SCATTER),
+  };
+  if (keys_pipeline == nullptr || pass_pipelines[0] == nullptr || pass_pipelines[1] == nullptr ||
+      pass_pipelines[2] == nullptr) {
+    return;
+  }
+
+  uint32_t region_offset = g_data.data_region_index * sort_region_size() / sizeof(uint32_t);
+  for (uint32_t step = 0; step < SORT_STEP_COUNT; step++) {
+    uint32_t                pass     = step > 0 ? (step - 1) / 3 : 0;
+    SDL_GPUComputePipeline* pipeline = keys_pipeline;
+    if (step > 0) { pipeline = pass_pipelines[(step - 1) % 3]; }
+
+    SDL_GPUStorageBufferReadWriteBinding binding = {};
+    binding.buffer                               = g_data.sort_buffer;
+    SDL_GPUComputePass* compute_pass =
+        SDL_BeginGPUComputePass(command_buffer, nullptr, 0, &binding, 1);
+    SDL_BindGPUComputePipeline(compute_pass, pipeline);
+
+    SDL_GPUBuffer* bound_buffer = nullptr;
+    for (uint32_t i = 0; i < g_data.draw_batch_count; i++) {
+      const Draw_Batch& batch = g_data.draw_batches[i];
+      if (!batch.gpu_sorted) { continue; }
+
+      if (step == 0 && batch.vertex_data_buffer != bound_buffer) {
+        SDL_GPUBuffer* storage_buffers[] = {batch.vertex_data_buffer, g_data.draw_buffer};
+        SDL_BindGPUComputeStorageBuffers(compute_pass, 0, storage_buffers, 2);
+        bound_buffer = batch.vertex_data_buffer;
+      }
+
+      // The keys alternate between the two arrays, starting and ending in the first one.
+      uint32_t group_count = (batch.instance_count + SORT_GROUP_SIZE - 1) / SORT_GROUP_SIZE;
+      uint32_t first_keys  = region_offset + batch.sort_offset;
+      uint32_t second_keys = first_keys + 2 * g_data.sort_capacity;
+      set_batch_uniforms(uniforms, i);
+      uniforms.sort_shift              = pass * 8;
+      uniforms.sort_group_count        = group_count;
+      uniforms.sort_source_offset      = pass % 2 == 0 ? first_keys : second_keys;
+      uniforms.sort_destination_offset = pass % 2 == 0 ? second_keys : first_keys;
+      uniforms.sort_count_offset       = first_keys + 4 * g_data.sort_capacity;
+      if (step == 0) { uniforms.sort_destination_offset = first_keys; }
+      SDL_PushGPUComputeUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+
+      uint32_t dispatch_count = pipeline == pass_pipelines[1] ? SORT_DIGIT_COUNT : group_count;
+      SDL_DispatchGPUCompute(compute_pass, dispatch_count, 1, 1);
+    }
+    SDL_EndGPUComputePass(compute_pass);
+  }
+}
+
+// Writes the draw lists to the current data region of the transfer buffer and fills in the ranges
+// to upload. Lists emitted in place by begin_vertex_emission are left where they are, the others
+// are appended after them, and lists which are resident or get promoted are skipped.
+static bool write_draw_lists() {
+  g_data.upload_range_count = 0;
+
+  uint32_t draw_list_count        = Im3d::GetDrawListCount();
+  uint32_t requested_vertex_count = 0;
+  for (uint32_t i = 0; i < draw_list_count; i++) {
+    const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+    if (find_retained_layer(draw_list.m_layerId) != nullptr) { continue; }
+    requested_vertex_count +=
+        expand_indexed_triangles(draw_list) ? draw_list.m_indexCount : draw_list.m_vertexCount;
+  }
+
+  // A region was already claimed for this frame if vertices were emitted in place. It is claimed
+  // before any early return, the other ring writers use the same region.
+  const uint8_t* emission_data = nullptr;
+  if (g_data.mapped_data != nullptr) {
+    emission_data = g_data.mapped_data + g_data.data_region_index * g_data.data_region_size;
+  } else {
+    g_data.data_region_index = (g_data.data_region_index + 1) % g_data.data_region_count;
+  }
+  uint32_t emission_size = g_data.data_region_size;
+
+  const Im3d::AppData& app_data = Im3d::GetAppData();
+  if (app_data.m_viewportSize.x <= 0.0f || app_data.m_viewportSize.y <= 0.0f) { return false; }
+
+  if (g_data.draw_list_info_capacity < draw_list_count) {
+    uint32_t capacity = SDL_max(draw_list_count, g_data.draw_list_info_capacity * 2);
+    auto     draw_list_infos = static_cast<Draw_List_Info*>(
+        SDL_realloc(g_data.draw_list_infos, capacity * sizeof(Draw_List_Info)));
+    if (draw_list_infos == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate draw list infos");
+      SDL_assert(false);
+      return false;
+    }
+    for (uint32_t i = g_data.draw_list_info_capacity; i < capacity; i++) {
+      draw_list_infos[i] = {};
+    }
+    g_data.draw_list_infos         = draw_list_infos;
+    g_data.draw_list_info_capacity = capacity;
+  }
+  // Draw lists are matched against last frame's list of the same layer and primitive type, so that
+  // a list appearing or disappearing doesn't invalidate the lists after it.
+  for (uint32_t i = 0; i < draw_list_count; i++) {
+    const Im3d::DrawList& draw_list  = Im3d::GetDrawLists()[i];
+    Layer_Info*           layer_info = find_layer_info(draw_list.m_layerId);
+    if (layer_info != nullptr) { layer_info->seen_frame = g_data.frame_index; }
+
+    for (uint32_t j = i; j < g_data.draw_list_info_count; j++) {
+      const Draw_List_Info& info = g_data.draw_list_infos[j];
+      if (info.layer_id != draw_list.m_layerId || info.prim_type != draw_list.m_primType) {
+        continue;
+      }
+      if (j != i) {
+        Draw_List_Info match      = g_data.draw_list_infos[j];
+        g_data.draw_list_infos[j] = g_data.draw_list_infos[i];
+        g_data.draw_list_infos[i] = match;
+      }
+      break;
+    }
+  }
+  for (uint32_t i = draw_list_count; i < g_data.draw_list_info_count; i++) {
+    evict_resident_draw_list(g_data.draw_list_infos[i]);
+    g_data.draw_list_infos[i] = {};
+  }
+  g_data.draw_list_info_count = draw_list_count;
+  prune_layer_infos();
+
+  // Vertices are hashed unless the app provides a layer generation, except when emitted in place
+  // since reading back the transfer buffer memory would cost more than uploading it.
+  uint64_t emitted_end   = 0;
+  uint64_t copied_size   = 0;
+  uint64_t promoted_size = 0;
+  for (uint32_t i = 0; i < draw_list_count; i++) {
+    const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+    Draw_List_Info&       info      = g_data.draw_list_infos[i];
+    uint64_t              size      = uint64_t(draw_list.m_vertexCount) * g_data.vertex_stride;
+    int64_t               offset    = emitted_offset(draw_list, emission_data, emission_size);
+    if (offset >= 0) { emitted_end = SDL_max(emitted_end, uint64_t(offset) + size); }
+
+    // Expanded lists are copied after the emitted ones, which they are read from.
+    info.index_expanded = expand_indexed_triangles(draw_list);
+    if (info.index_expanded) {
+      offset = -1;
+      size   = uint64_t(draw_list.m_indexCount) * g_data.vertex_stride;
+    }
+
+    info.retained = find_retained_layer(draw_list.m_layerId) != nullptr;
+    if (info.retained) {
+      evict_resident_draw_list(info);
+      info.has_fingerprint = false;
+      info.promote         = false;
+      continue;
+    }
+
+    // The fingerprint doesn't cover index data, indexed lists are uploaded every frame.
+    bool     has_fingerprint = false;
+    uint64_t fingerprint     = 0;
+    if (g_data.init_info.cache_draw_lists &&
+        draw_list.m_primType != Im3d::DrawPrimitive_IndexedTriangles) {
+      const Layer_Info* layer_info = find_layer_info(draw_list.m_layerId);
+      if (layer_info != nullptr && layer_info->has_generation) {
+        has_fingerprint = true;
+        fingerprint     = layer_info->generation;
+      } else if (offset < 0) {
+        has_fingerprint = true;
+        fingerprint     = hash_vertex_data(draw_list.m_vertexData, draw_list.m_vertexCount);
+      }
+    }
+    bool unchanged = has_fingerprint && info.has_fingerprint && info.fingerprint == fingerprint &&
+                     info.layer_id == draw_list.m_layerId &&
+                     info.prim_type == draw_list.m_primType &&
+                     info.fingerprint_vertex_count == draw_list.m_vertexCount;
+
+    // Promoted lists are copied on the GPU from where they were uploaded last frame.
+    info.promote = unchanged && !info.resident && info.ring_frame + 1 == g_data.frame_index &&
+                   info.ring_generation == g_data.data_buffer_generation &&
+                   info.ring_vertex_count == draw_list.m_vertexCount;
+    if (!unchanged) { evict_resident_draw_list(info); }
+
+    info.layer_id                 = draw_list.m_layerId;
+    info.prim_type                = draw_list.m_primType;
+    info.has_fingerprint          = has_fingerprint;
+    info.fingerprint              = fingerprint;
+    info.fingerprint_vertex_count = draw_list.m_vertexCount;
+
+    if (info.promote) {
+      promoted_size += size;
+    } else if (!info.resident && offset < 0) {
+      copied_size += size;
+    }
+  }
+
+  // Recreating the buffers retires the mapping, in which case every list is copied. Promoted lists
+  // are included so that the ring doesn't shrink when they fail to fit in the resident buffer.
+  if (!reserve_data_buffers(emitted_end + copied_size + promoted_size)) { return false; }
+  if (requested_vertex_count == 0 || g_data.data_buffer == nullptr) { return false; }
+  if (g_data.mapped_data == nullptr) {
+    emission_data = nullptr;
+    emitted_end   = 0;
+  }
+
+  if (g_data.mapped_data == nullptr) {
+    g_data.mapped_data = static_cast<uint8_t*>(
+        SDL_MapGPUTransferBuffer(g_data.init_info.device, g_data.transfer_buffer, false));
+    if (g_data.mapped_data == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to map transfer buffer: %s",
+          SDL_GetError());
+      SDL_assert(false);
+      return false;
+    }
+  }
+
+  if (!reserve_resident_buffer(promoted_size)) {
+    for (uint32_t i = 0; i < draw_list_count; i++) {
+      g_data.draw_list_infos[i].promote = false;
+    }
+  }
+
+  uint32_t region_offset   = g_data.data_region_index * g_data.data_region_size;
+  uint8_t* region_data     = g_data.mapped_data + region_offset;
+  uint32_t vertex_capacity = g_data.data_region_size / g_data.vertex_stride;
+  uint32_t vertex_offset   = uint32_t(emitted_end / g_data.vertex_stride);
+  uint64_t copy_size       = 0;
+
+  // Destination offsets are a prefix sum over the copied lists, so the copy jobs are independent.
+  g_data.copy_job_count = 0;
+  for (uint32_t i = 0; i < draw_list_count; i++) {
+    const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+    Draw_List_Info&       info      = g_data.draw_list_infos[i];
+
+    if (info.retained) {
+      info.vertex_count = 0;
+      continue;
+    }
+    if (info.resident || info.promote) {
+      info.vertex_count          = draw_list.m_vertexCount;
+      g_data.total_vertex_count += info.vertex_count;
+      continue;
+    }
+
+    int64_t offset =
+        info.index_expanded ? -1 : emitted_offset(draw_list, emission_data, emission_size);
+    if (offset >= 0) {
+      info.vertex_offset = uint32_t(offset / g_data.vertex_stride);
+      info.vertex_count  = fit_draw_list(draw_list, draw_list.m_vertexCount);
+      if (!push_upload_range(uint32_t(offset), info.vertex_count * g_data.vertex_stride)) {
+        SDL_assert(false);
+        return false;
+      }
+    } else {
+      info.vertex_offset = vertex_offset;
+      info.vertex_count  = info.index_expanded
+                               ? fit_expanded_draw_list(draw_list, vertex_capacity - vertex_offset)
+                               : fit_draw_list(draw_list, vertex_capacity - vertex_offset);
+
+      uint32_t job_vertex_count = info.vertex_count;
+      if (g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_FULL) {
+        job_vertex_count = SDL_max(COPY_JOB_SIZE / g_data.vertex_stride, 1u);
+      }
+      for (uint32_t first = 0; first < info.vertex_count; first += job_vertex_count) {
+        if (!push_copy_job(i, first, SDL_min(job_vertex_count, info.vertex_count - first))) {
+          SDL_assert(false);
+          return false;
+        }
+      }
+      vertex_offset += info.vertex_count;
+      copy_size     += uint64_t(info.vertex_count) * g_data.vertex_stride;
+    }
+    info.ring_offset           = region_offset + info.vertex_offset * g_data.vertex_stride;
+    info.ring_vertex_count     = info.vertex_count;
+    info.ring_frame            = g_data.frame_index;
+    info.ring_generation       = g_data.data_buffer_generation;
+    g_data.total_vertex_count += info.vertex_count;
+  }
+
+  g_data.copy_region_data = region_data;
+  execute_copy_jobs(copy_size);
+
+  uint32_t copied_start = uint32_t(emitted_end);
+  if (!push_upload_range(copied_start, vertex_offset * g_data.vertex_stride - copied_start)) {
+    SDL_assert(false);
+    return false;
+  }
+  merge_upload_ranges();
+
+  g_data.memory_stats.dropped_vertex_count = requested_vertex_count - g_data.total_vertex_count;
+  return g_data.total_vertex_count > 0;
+}
+
+static bool reserve_upload_ring(
+    Upload_Ring&            ring,
+    uint32_t                size,
+    SDL_GPUBufferUsageFlags usage,
+    const char*             name) {
+  if (size <= ring.region_size) { return true; }
+
+  uint32_t region_size = SDL_max(size, ring.region_size * 2);
+  region_size          = SDL_max(region_size, MIN_DATA_REGION_SIZE);
+  region_size          = (region_size + DATA_REGION_ALIGNMENT - 1) & ~(DATA_REGION_ALIGNMENT - 1);
+  uint32_t buffer_size = region_size * g_data.data_region_count;
+  int64_t  size_old    = 2 * int64_t(ring.region_size) * g_data.data_region_count;
+  if (!within_memory_budget(2 * int64_t(buffer_size) - size_old, name)) { return false; }
+
+  SDL_GPUBuffer* buffer;
+  {
+    SDL_GPUBufferCreateInfo info = {};
+    info.size                    = buffer_size;
+    info.usage                   = usage;
+    buffer                       = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+    if (buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create %s buffer: %s",
+          name,
+          SDL_GetError());
+      return false;
+    }
+  }
+  SDL_GPUTransferBuffer* transfer_buffer;
+  {
+    SDL_GPUTransferBufferCreateInfo info = {};
+    info.size                            = buffer_size;
+    info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
+    if (transfer_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create transfer buffer: %s",
+          SDL_GetError());
+      SDL_ReleaseGPUBuffer(g_data.init_info.device, buffer);
+      return false;
+    }
+  }
+
+  release_upload_ring(ring);
+  track_memory(2 * int64_t(buffer_size));
+
+  ring.buffer          = buffer;
+  ring.transfer_buffer = transfer_buffer;
+  ring.region_size     = region_size;
+  return true;
+}
+
+// Returns the current region of ring's transfer buffer, unmapped by the caller.
+static uint8_t* map_upload_ring(const Upload_Ring& ring) {
+  auto mapped_data = static_cast<uint8_t*>(
+      SDL_MapGPUTransferBuffer(g_data.init_info.device, ring.transfer_buffer, false));
+  if (mapped_data == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to map transfer buffer: %s",
+        SDL_GetError());
+    return nullptr;
+  }
+  return mapped_data + g_data.data_region_index * ring.region_size;
+}
+
+static void upload_ring(SDL_GPUCopyPass* copy_pass, const Upload_Ring& ring) {
+  if (ring.size == 0) { return; }
+  uint32_t region_offset = g_data.data_region_index * ring.region_size;
+
+  SDL_GPUTransferBufferLocation location = {};
+  location.transfer_buffer               = ring.transfer_buffer;
+  location.offset                        = region_offset;
+
+  SDL_GPUBufferRegion buffer_region = {};
+  buffer_region.buffer              = ring.buffer;
+  buffer_region.offset              = region_offset;
+  buffer_region.size                = ring.size;
+
+  SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+}
+
+// Writes the indices of this frame's indexed draw lists to the current region of the index buffer,
+// 16-bit when the indexed vertices allow. With the full vertex format the indices are rebased to
+// the start of the data region, so that push_indexed_draw can draw consecutive lists together.
+// Each list's indices are aligned to their size, the draws index from the start of the region.
+static bool write_index_data() {
+  bool     rebased         = g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_FULL;
+  uint32_t draw_list_count = g_data.draw_list_info_count;
+  uint32_t index_size      = 0;
+  for (uint32_t i = 0; i < draw_list_count; i++) {
+    const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+    Draw_List_Info&       info      = g_data.draw_list_infos[i];
+
+    info.index_count = 0;
+    if (draw_list.m_primType != Im3d::DrawPrimitive_IndexedTriangles || info.vertex_count == 0 ||
+        info.index_expanded) {
+      continue;
+    }
+    uint32_t index_base   = rebased ? info.vertex_offset : 0;
+    info.index_count      = draw_list.m_indexCount - draw_list.m_indexCount % 3;
+    info.index_16bit      = index_base + info.vertex_count <= 0x10000;
+    uint32_t element_size = info.index_16bit ? 2 : 4;
+    info.index_offset     = (index_size + element_size - 1) & ~(element_size - 1);
+    index_size            = info.index_offset + info.index_count * element_size;
+  }
+  if (index_size == 0) { return true; }
+  index_size = (index_size + 3) & ~3u;
+
+  uint8_t* region_data = nullptr;
+  if (reserve_upload_ring(g_data.index_ring, index_size, SDL_GPU_BUFFERUSAGE_INDEX, "index")) {
+    region_data = map_upload_ring(g_data.index_ring);
+  }
+  if (region_data == nullptr) {
+    for (uint32_t i = 0; i < draw_list_count; i++) {
+      g_data.draw_list_infos[i].index_count = 0;
+    }
+    return false;
+  }
+
+  for (uint32_t i = 0; i < draw_list_count; i++) {
+    const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+    const Draw_List_Info& info      = g_data.draw_list_infos[i];
+    if (info.index_count == 0) { continue; }
+
+    uint32_t index_base = rebased ? info.vertex_offset : 0;
+    if (info.index_16bit) {
+      auto indices = reinterpret_cast<uint16_t*>(region_data + info.index_offset);
+      for (uint32_t j = 0; j < info.index_count; j++) {
+        indices[j] = uint16_t(index_base + draw_list.m_indexData[j]);
+      }
+    } else if (index_base > 0) {
+      auto indices = reinterpret_cast<uint32_t*>(region_data + info.index_offset);
+      for (uint32_t j = 0; j < info.index_count; j++) {
+        indices[j] = index_base + draw_list.m_indexData[j];
+      }
+    } else {
+      SDL_memcpy(
+          region_data + info.index_offset,
+          draw_list.m_indexData,
+          info.index_count * sizeof(uint32_t));
+    }
+  }
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.index_ring.transfer_buffer);
+
+  g_data.index_ring.size = index_size;
+  return true;
+}
+
+static Mesh* find_mesh(Im3d_SDL3_GPU_Mesh mesh_id) {
+  if (mesh_id == 0 || mesh_id > g_data.mesh_count) { return nullptr; }
+  Mesh* mesh = &g_data.meshes[mesh_id - 1];
+  return mesh->buffer != nullptr ? mesh : nullptr;
+}
+
+static void release_mesh(Mesh& mesh) {
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, mesh.buffer);
+  SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, mesh.upload_buffer);
+  SDL_free(mesh.instances);
+  release_depth_runs(mesh.runs);
+  release_depth_runs(mesh.draw_runs);
+  track_memory(-int64_t(mesh.vertex_count * sizeof(Im3d::Vec4)));
+  mesh = {};
+}
+
+// Writes the instances submitted for each mesh since the last prepare to the current region of the
+// mesh instance ring, contiguous per mesh so that each mesh is a single instanced draw.
+static bool write_mesh_instances() {
+  uint32_t instance_count = 0;
+  for (uint32_t i = 0; i < g_data.mesh_count; i++) {
+    Mesh& mesh               = g_data.meshes[i];
+    mesh.first_draw_instance = instance_count;
+    mesh.draw_instance_count = mesh.instance_count;
+    instance_count          += mesh.instance_count;
+    swap_depth_runs(mesh.runs, mesh.draw_runs);
+  }
+  if (instance_count == 0) { return true; }
+
+  uint8_t* region_data = nullptr;
+  uint32_t size        = instance_count * sizeof(Im3d_SDL3_GPU_Mesh_Instance);
+  if (reserve_upload_ring(
+          g_data.mesh_instance_ring,
+          size,
+          SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+          "mesh instance")) {
+    region_data = map_upload_ring(g_data.mesh_instance_ring);
+  }
+
+  for (uint32_t i = 0; i < g_data.mesh_count; i++) {
+    Mesh& mesh = g_data.meshes[i];
+    if (region_data == nullptr) {
+      mesh.draw_instance_count = 0;
+    } else if (mesh.instance_count > 0) {
+      SDL_memcpy(
+          region_data + mesh.first_draw_instance * sizeof(Im3d_SDL3_GPU_Mesh_Instance),
+          mesh.instances,
+          mesh.instance_count * sizeof(Im3d_SDL3_GPU_Mesh_Instance));
+    }
+    mesh.instance_count = 0;
+  }
+  if (region_data == nullptr) { return false; }
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.mesh_instance_ring.transfer_buffer);
+
+  g_data.mesh_instance_ring.size = size;
+  return true;
+}
+
+// True when a mesh was created since the last copy pass or has instances this frame.
+static bool has_mesh_uploads() {
+  if (g_data.mesh_instance_ring.size > 0) { return true; }
+  for (uint32_t i = 0; i < g_data.mesh_count; i++) {
+    if (g_data.meshes[i].upload_buffer != nullptr) { return true; }
+  }
+  return false;
+}
+
+// Draws the instances of each mesh submitted this frame, lines as a quad per line and instance.
+static void render_mesh_instances(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass*    render_pass,
+    Target_Pipelines&     target_pipelines,
+    Vertex_Uniforms&      uniforms) {
+  for (uint32_t i = 0; i < g_data.mesh_count; i++) {
+    const Mesh& mesh = g_data.meshes[i];
+    if (mesh.draw_instance_count == 0) { continue; }
+
+    bool     lines         = mesh.type == IM3D_SDL3_GPU_MESH_TYPE_LINES;
+    uint32_t region_offset = g_data.data_region_index * g_data.mesh_instance_ring.region_size;
+    uniforms.primitive_vertex_count  = lines ? 2 : 3;
+    uniforms.primitive_vertex_stride = uniforms.primitive_vertex_count;
+    uniforms.mesh_primitive_count    = lines ? mesh.vertex_count / 2 : 1;
+
+    // Each run of instances is drawn in the depth mode of the layer it was submitted in.
+    for (uint32_t j = 0; j < mesh.draw_runs.count; j++) {
+      const Depth_Run&         run      = mesh.draw_runs.runs[j];
+      SDL_GPUGraphicsPipeline* pipeline = graphics_pipeline(
+          target_pipelines,
+          lines ? GRAPHICS_PIPELINE_MESH_LINES : GRAPHICS_PIPELINE_MESH_TRIANGLES,
+          depth_state(run.depth_mode, !lines));
+      if (pipeline == nullptr) { continue; }
+      SDL_BindGPUGraphicsPipeline(render_pass, pipeline);
+
+      // The segment buffer slot is unused by mesh draws.
+      SDL_GPUBuffer* storage_buffers[] = {
+          mesh.buffer,
+          mesh.buffer,
+          g_data.mesh_instance_ring.buffer,
+      };
+      SDL_BindGPUVertexStorageBuffers(render_pass, 0, storage_buffers, 3);
+
+      // Line meshes draw an instance per line of each record, the records are split across draws
+      // whose instance counts fit in 32 bits.
+      uint32_t draw_records = SDL_MAX_UINT32 / SDL_max(uniforms.mesh_primitive_count, 1u);
+      for (uint64_t first = 0; first < run.count; first += draw_records) {
+        uint32_t record_count = uint32_t(SDL_min(uint64_t(draw_records), run.count - first));
+        uniforms.mesh_instance_offset = region_offset / sizeof(Im3d_SDL3_GPU_Mesh_Instance) +
+                                        mesh.first_draw_instance + run.first + uint32_t(first);
+        SDL_PushGPUVertexUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+
+        if (lines) {
+          uint64_t instance_count = uint64_t(record_count) * uniforms.mesh_primitive_count;
+          SDL_DrawGPUPrimitives(render_pass, 4, uint32_t(instance_count), 0, 0);
+        } else {
+          SDL_DrawGPUPrimitives(render_pass, mesh.vertex_count, record_count, 0, 0);
+        }
+      }
+    }
+  }
+}
+
+// Rings and the lines joining them, see load_shape_line in im3d_sdl3_gpu.hlsl.
+static uint32_t shape_line_count(uint32_t type, uint32_t detail) {
+  switch (type) {
+  case IM3D_SDL3_GPU_SHAPE_SPHERE:
+    return 3 * detail;
+  case IM3D_SDL3_GPU_SHAPE_CAPSULE:
+    return 4 * detail + 4;
+  case IM3D_SDL3_GPU_SHAPE_CONE:
+    return detail + 4;
+  default:
+    return detail;
+  }
+}
+
+// Writes the shapes submitted since the last prepare to the current region of the shape ring.
+static bool write_shapes() {
+  g_data.shape_draw_count = 0;
+  swap_depth_runs(g_data.shape_runs, g_data.shape_draw_runs);
+  if (g_data.shape_count == 0) { return true; }
+
+  uint32_t shape_count = g_data.shape_count;
+  g_data.shape_count   = 0;
+
+  uint32_t size = shape_count * sizeof(Shape_Record);
+  if (!reserve_upload_ring(
+          g_data.shape_ring,
+          size,
+          SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+          "shape")) {
+    return false;
+  }
+  uint8_t* region_data = map_upload_ring(g_data.shape_ring);
+  if (region_data == nullptr) { return false; }
+  SDL_memcpy(region_data, g_data.shapes, size);
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.shape_ring.transfer_buffer);
+
+  g_data.shape_ring.size  = size;
+  g_data.shape_draw_count = shape_count;
+  return true;
+}
+
+// Draws every shape line as a quad, the vertex shader finds the line's shape and generates it.
+// Each run of shapes is drawn in the depth mode of the layer it was submitted in.
+static void render_shapes(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass*    render_pass,
+    Target_Pipelines&     target_pipelines,
+    Vertex_Uniforms&      uniforms) {
+  uint32_t region_offset = g_data.data_region_index * g_data.shape_ring.region_size;
+  for (uint32_t i = 0; i < g_data.shape_draw_runs.count; i++) {
+    const Depth_Run&         run      = g_data.shape_draw_runs.runs[i];
+    SDL_GPUGraphicsPipeline* pipeline = graphics_pipeline(
+        target_pipelines,
+        GRAPHICS_PIPELINE_SHAPES,
+        depth_state(run.depth_mode, false));
+    if (pipeline == nullptr) { continue; }
+    SDL_BindGPUGraphicsPipeline(render_pass, pipeline);
+
+    // Only the shape buffer is read.
+    SDL_GPUBuffer* storage_buffers[] = {
+        g_data.shape_ring.buffer,
+        g_data.shape_ring.buffer,
+        g_data.shape_ring.buffer,
+    };
+    SDL_BindGPUVertexStorageBuffers(render_pass, 0, storage_buffers, 3);
+
+    uniforms.shape_offset            = region_offset / sizeof(Shape_Record) + run.first;
+    uniforms.shape_count             = run.count;
+    uniforms.primitive_vertex_count  = 2;
+    uniforms.primitive_vertex_stride = 2;
+    SDL_PushGPUVertexUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+
+    SDL_DrawGPUPrimitives(render_pass, 4, run.line_count, 0, 0);
+  }
+}
+
+// Writes the filled shapes submitted since the last prepare to the current region of the impostor
+// ring.
+static bool write_impostors() {
+  g_data.impostor_draw_count = 0;
+  swap_depth_runs(g_data.impostor_runs, g_data.impostor_draw_runs);
+  if (g_data.impostor_count == 0) { return true; }
+
+  uint32_t impostor_count = g_data.impostor_count;
+  g_data.impostor_count   = 0;
+
+  uint32_t size = impostor_count * sizeof(Shape_Record);
+  if (!reserve_upload_ring(
+          g_data.impostor_ring,
+          size,
+          SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+          "impostor")) {
+    return false;
+  }
+  uint8_t* region_data = map_upload_ring(g_data.impostor_ring);
+  if (region_data == nullptr) { return false; }
+  SDL_memcpy(region_data, g_data.impostors, size);
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.impostor_ring.transfer_buffer);
+
+  g_data.impostor_ring.size  = size;
+  g_data.impostor_draw_count = impostor_count;
+  return true;
+}
+
+// Draws every filled shape as a quad over its bounds on screen, the fragment shader ray casts the
+// surface and writes its depth. Each run of them is drawn in the depth mode of its layer.
+static void render_impostors(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass*    render_pass,
+    Target_Pipelines&     target_pipelines,
+    Vertex_Uniforms&      uniforms) {
+  uint32_t region_offset = g_data.data_region_index * g_data.impostor_ring.region_size;
+  for (uint32_t i = 0; i < g_data.impostor_draw_runs.count; i++) {
+    const Depth_Run&         run      = g_data.impostor_draw_runs.runs[i];
+    SDL_GPUGraphicsPipeline* pipeline = graphics_pipeline(
+        target_pipelines,
+        GRAPHICS_PIPELINE_IMPOSTORS,
+        depth_state(run.depth_mode, true));
+    if (pipeline == nullptr) { continue; }
+    SDL_BindGPUGraphicsPipeline(render_pass, pipeline);
+
+    // Only the impostor buffer is read.
+    SDL_GPUBuffer* storage_buffers[] = {
+        g_data.impostor_ring.buffer,
+        g_data.impostor_ring.buffer,
+        g_data.impostor_ring.buffer,
+    };
+    SDL_BindGPUVertexStorageBuffers(render_pass, 0, storage_buffers, 3);
+
+    uniforms.shape_offset = region_offset / sizeof(Shape_Record) + run.first;
+    uniforms.shape_count  = run.count;
+    SDL_PushGPUVertexUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+
+    SDL_DrawGPUPrimitives(render_pass, 4, run.count, 0, 0);
+  }
+}
+
+static int SDLCALL compare_glyphs(const void* a, const void* b) {
+  uint32_t codepoint_a = static_cast<const Im3d_SDL3_GPU_Glyph*>(a)->codepoint;
+  uint32_t codepoint_b = static_cast<const Im3d_SDL3_GPU_Glyph*>(b)->codepoint;
+  return codepoint_a < codepoint_b ? -1 : (codepoint_a > codepoint_b ? 1 : 0);
+}
+
+static const Im3d_SDL3_GPU_Glyph* search_glyph(uint32_t codepoint) {
+  uint32_t first = 0;
+  uint32_t last  = g_data.font_glyph_count;
+  while (first < last) {
+    uint32_t middle = (first + last) / 2;
+    if (g_data.font_glyphs[middle].codepoint < codepoint) {
+      first = middle + 1;
+    } else {
+      last = middle;
+    }
+  }
+  if (first < g_data.font_glyph_count && g_data.font_glyphs[first].codepoint == codepoint) {
+    return &g_data.font_glyphs[first];
+  }
+  return nullptr;
+}
+
+// Returns the glyph of codepoint, or the fallback glyph, null when the font has neither.
+static const Im3d_SDL3_GPU_Glyph* find_glyph(uint32_t codepoint) {
+  if (codepoint < SDL_arraysize(g_data.font_ascii_glyphs)) {
+    return g_data.font_ascii_glyphs[codepoint];
+  }
+  const Im3d_SDL3_GPU_Glyph* glyph = search_glyph(codepoint);
+  return glyph != nullptr ? glyph : g_data.font_fallback_glyph;
+}
+
+// Decodes the UTF-8 sequence at text and moves past it. Invalid sequences decode to U+FFFD and only
+// skip the bytes read so far, the second byte's range rules out overlong encodings, surrogates and
+// codepoints above U+10FFFF.
+static uint32_t decode_utf8(const char*& text, const char* end) {
+  uint8_t lead = uint8_t(*text++);
+  if (lead < 0x80) { return lead; }
+
+  uint32_t length = 0;
+  uint8_t  lower  = 0x80;
+  uint8_t  upper  = 0xBF;
+  if (lead >= 0xC2 && lead <= 0xDF) {
+    length = 1;
+  } else if (lead >= 0xE0 && lead <= 0xEF) {
+    length = 2;
+    if (lead == 0xE0) { lower = 0xA0; }
+    if (lead == 0xED) { upper = 0x9F; }
+  } else if (lead >= 0xF0 && lead <= 0xF4) {
+    length = 3;
+    if (lead == 0xF0) { lower = 0x90; }
+    if (lead == 0xF4) { upper = 0x8F; }
+  }
+  if (length == 0 || uint32_t(end - text) < length) { return REPLACEMENT_CHARACTER; }
+  uint32_t codepoint = lead & (0x3F >> length);
+  for (uint32_t i = 0; i < length; i++) {
+    uint8_t continuation = uint8_t(*text);
+    if (continuation < lower || continuation > upper) { return REPLACEMENT_CHARACTER; }
+    codepoint = codepoint << 6 | (continuation & 0x3F);
+    lower     = 0x80;
+    upper     = 0xBF;
+    text++;
+  }
+  return codepoint;
+}
+
+static void release_font() {
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.font_glyph_buffer);
+  SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.font_upload_buffer);
+  SDL_free(g_data.font_glyphs);
+  track_memory(-int64_t(g_data.font_glyph_count * sizeof(Glyph_Record)));
+  g_data.font_glyph_buffer   = nullptr;
+  g_data.font_upload_buffer  = nullptr;
+  g_data.font_glyphs         = nullptr;
+  g_data.font_glyph_count    = 0;
+  g_data.font_fallback_glyph = nullptr;
+
+  // Runs index the glyphs of the font, their allocations are kept for the next font.
+  for (uint32_t i = 0; i < g_data.text_run_set_count * TEXT_RUN_WAYS; i++) {
+    g_data.text_runs[i].key = 0;
+  }
+}
+
+// Lays out text into glyphs and returns how many there are. Like Im3d's examples the text is
+// centered on its position unless its flags align it, every line is aligned on its own.
+static uint32_t layout_text(
+    const char*     text,
+    uint32_t        text_length,
+    uint32_t        flags,
+    Text_Run_Glyph* glyphs) {
+  const char* end         = text + text_length;
+  float       line_height = g_data.font_line_height;
+
+  uint32_t line_count = 1;
+  for (const char* c = text; c < end; c++) { line_count += *c == '\n' ? 1 : 0; }
+  float y = -0.5f * float(line_count) * line_height;
+  if ((flags & Im3d::TextFlags_AlignTop) != 0) {
+    y = -float(line_count) * line_height;
+  } else if ((flags & Im3d::TextFlags_AlignBottom) != 0) {
+    y = 0.0f;
+  }
+
+  uint32_t glyph_count = 0;
+  while (text < end) {
+    const char* line_end = text;
+    float       width    = 0.0f;
+    while (line_end < end && *line_end != '\n') {
+      const Im3d_SDL3_GPU_Glyph* glyph = find_glyph(decode_utf8(line_end, end));
+      if (glyph != nullptr) { width += glyph->advance; }
+    }
+
+    float x = -0.5f * width;
+    if ((flags & Im3d::TextFlags_AlignLeft) != 0) {
+      x = -width;
+    } else if ((flags & Im3d::TextFlags_AlignRight) != 0) {
+      x = 0.0f;
+    }
+
+    // Glyphs with an empty plane rect, like spaces, only advance the pen.
+    while (text < line_end) {
+      const Im3d_SDL3_GPU_Glyph* glyph = find_glyph(decode_utf8(text, line_end));
+      if (glyph == nullptr) { continue; }
+      if (glyph->plane_rect.z > glyph->plane_rect.x && glyph->plane_rect.w > glyph->plane_rect.y) {
+        glyphs[glyph_count++] = {Im3d::Vec2(x, y), uint32_t(glyph - g_data.font_glyphs)};
+      }
+      x += glyph->advance;
+    }
+
+    if (text < end) { text++; }
+    y += line_height;
+  }
+  return glyph_count;
+}
+
+// Returns the run of text laid out for flags, laying it out over the least recently used run of
+// its set on a miss. Labels are mostly the same strings every frame, so most texts only cost a
+// hash. Runs are shared by every text size, the vertex shader scales them. Returns null when the
+// run can't be allocated.
+static const Text_Run* find_text_run(const char* text, uint32_t text_length, uint32_t flags) {
+  // The key leaves out the size, runs are laid out in font units, and the font, release_font
+  // empties the runs when im3d_sdl3_gpu_set_font replaces it.
+  uint64_t  key     = hash_text(text, text_length, flags);
+  uint32_t  set     = uint32_t(key >> 32) & (g_data.text_run_set_count - 1);
+  Text_Run* runs    = &g_data.text_runs[set * TEXT_RUN_WAYS];
+  Text_Run* lru_run = &runs[0];
+  for (uint32_t i = 0; i < TEXT_RUN_WAYS; i++) {
+    Text_Run& run = runs[i];
+    if (run.key == key && run.flags == flags && run.text_length == text_length &&
+        SDL_memcmp(run.glyphs + text_length, text, text_length) == 0) {
+      run.last_used_frame = g_data.frame_index;
+      return &run;
+    }
+
+    // Empty runs are replaced first, then the one unused for the most frames.
+    uint32_t age     = g_data.frame_index - run.last_used_frame;
+    uint32_t lru_age = g_data.frame_index - lru_run->last_used_frame;
+    if (lru_run->key != 0 && (run.key == 0 || age > lru_age)) { lru_run = &run; }
+  }
+
+  // Each byte of text is at most one glyph.
+  Text_Run& run       = *lru_run;
+  uint32_t  data_size = text_length * uint32_t(sizeof(Text_Run_Glyph) + 1);
+  if (data_size > run.data_capacity) {
+    auto data = static_cast<Text_Run_Glyph*>(SDL_realloc(run.glyphs, data_size));
+    if (data == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate text run");
+      return nullptr;
+    }
+    run.glyphs        = data;
+    run.data_capacity = data_size;
+  }
+  SDL_memcpy(run.glyphs + text_length, text, text_length);
+  run.key             = key;
+  run.flags           = flags;
+  run.text_length     = text_length;
+  run.glyph_count     = layout_text(text, text_length, flags, run.glyphs);
+  run.last_used_frame = g_data.frame_index;
+  return &run;
+}
+
+static void release_text_runs() {
+  for (uint32_t i = 0; i < g_data.text_run_set_count * TEXT_RUN_WAYS; i++) {
+    SDL_free(g_data.text_runs[i].glyphs);
+  }
+  SDL_free(g_data.text_runs);
+  g_data.text_runs          = nullptr;
+  g_data.text_run_set_count = 0;
+}
+
+// Writes the glyph instances of this frame's text draw lists to the current region of the text
+// ring, contiguous per list so that each list is a single instanced draw. Text is drawn over
+// everything unless its layer has a depth mode, see im3d_sdl3_gpu_set_layer_depth_mode.
+static bool write_text() {
+  g_data.text_draw_count = 0;
+  uint32_t text_draw_list_count = Im3d::GetTextDrawListCount();
+  if (g_data.font_glyph_count == 0 || text_draw_list_count == 0) { return true; }
+
+  // Each byte of text is at most one glyph.
+  uint32_t max_instance_count = 0;
+  for (uint32_t i = 0; i < text_draw_list_count; i++) {
+    const Im3d::TextDrawList& text_draw_list = Im3d::GetTextDrawLists()[i];
+    for (uint32_t j = 0; j < text_draw_list.m_textDataCount; j++) {
+      max_instance_count += text_draw_list.m_textData[j].m_textLength;
+    }
+  }
+  if (max_instance_count == 0) { return true; }
+
+  if (text_draw_list_count > g_data.text_draw_capacity) {
+    uint32_t capacity = SDL_max(g_data.text_draw_capacity, MIN_DRAW_CAPACITY);
+    while (capacity < text_draw_list_count) { capacity *= 2; }
+
+    auto text_draws =
+        static_cast<Text_Draw*>(SDL_realloc(g_data.text_draws, capacity * sizeof(Text_Draw)));
+    if (text_draws == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate text draws");
+      return false;
+    }
+    g_data.text_draws         = text_draws;
+    g_data.text_draw_capacity = capacity;
+  }
+
+  if (!reserve_upload_ring(
+          g_data.text_ring,
+          max_instance_count * sizeof(Glyph_Instance),
+          SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ,
+          "text")) {
+    return false;
+  }
+  uint8_t* region_data = map_upload_ring(g_data.text_ring);
+  if (region_data == nullptr) { return false; }
+
+  auto     instances      = reinterpret_cast<Glyph_Instance*>(region_data);
+  uint32_t instance_count = 0;
+  for (uint32_t i = 0; i < text_draw_list_count; i++) {
+    const Im3d::TextDrawList& text_draw_list = Im3d::GetTextDrawLists()[i];
+    Text_Draw&                draw           = g_data.text_draws[g_data.text_draw_count];
+    draw.first_instance                      = instance_count;
+    for (uint32_t j = 0; j < text_draw_list.m_textDataCount; j++) {
+      const Im3d::TextData& text_data = text_draw_list.m_textData[j];
+      if (text_data.m_textLength == 0) { continue; }
+
+      const Text_Run* run = find_text_run(
+          text_draw_list.m_textBuffer + text_data.m_textBufferOffset,
+          text_data.m_textLength,
+          text_data.m_flags);
+      if (run == nullptr) {
+        SDL_assert(false);
+        continue;
+      }
+      Im3d::Vec3 position = Im3d::Vec3(text_data.m_positionSize);
+      float      size     = text_data.m_positionSize.w;
+      for (uint32_t k = 0; k < run->glyph_count; k++) {
+        instances[instance_count++] = {
+            position,
+            size,
+            run->glyphs[k].offset,
+            run->glyphs[k].glyph,
+            text_data.m_color,
+        };
+      }
+    }
+    draw.instance_count = instance_count - draw.first_instance;
+    if (draw.instance_count == 0) { continue; }
+
+    const Layer_Info*        layer_info = find_layer_info(text_draw_list.m_layerId);
+    Im3d_SDL3_GPU_Depth_Mode depth_mode =
+        layer_info != nullptr ? layer_info->depth_mode : IM3D_SDL3_GPU_DEPTH_MODE_DEFAULT;
+    draw.depth_state = depth_mode == IM3D_SDL3_GPU_DEPTH_MODE_DEFAULT
+                           ? DEPTH_STATE_OFF
+                           : depth_state(depth_mode, false);
+    g_data.text_draw_count++;
+  }
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.text_ring.transfer_buffer);
+
+  g_data.text_ring.size = instance_count * sizeof(Glyph_Instance);
+  return true;
+}
+
+// Draws each text draw list with one instanced draw, the vertex shader expands every glyph
+// instance into a quad. Always at the full viewport resolution, after the overlay is composited.
+// Skipped while a new font's glyphs are still to be uploaded.
+static void render_text(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass*    render_pass,
+    Target_Pipelines&     target_pipelines) {
+  if (g_data.font_upload_buffer != nullptr) { return; }
+
+  Vertex_Uniforms uniforms         = {};
+  uniforms.world_to_clip_transform = g_data.world_to_clip_transform;
+  uniforms.resolution              = Im3d::GetAppData().m_viewportSize;
+
+  {
+    SDL_GPUViewport viewport = {};
+    viewport.w               = uniforms.resolution.x;
+    viewport.h               = uniforms.resolution.y;
+    viewport.min_depth       = 0.0f;
+    viewport.max_depth       = 1.0f;
+    SDL_SetGPUViewport(render_pass, &viewport);
+  }
+
+  // The glyph quad's corners come from the quad vertex buffer, which nothing else may have bound in
+  // this render pass, e.g. when the overlay was composited or there are no other draws.
+  {
+    SDL_GPUBufferBinding binding = {};
+    binding.buffer               = g_data.vertex_buffer;
+    SDL_BindGPUVertexBuffers(render_pass, 0, &binding, 1);
+  }
+
+  // Glyph records are read from the data buffer slot, glyph instances from the instance slot.
+  SDL_GPUBuffer* storage_buffers[] = {
+      g_data.font_glyph_buffer,
+      g_data.font_glyph_buffer,
+      g_data.text_ring.buffer,
+  };
+  SDL_BindGPUVertexStorageBuffers(render_pass, 0, storage_buffers, 3);
+
+  SDL_GPUTextureSamplerBinding binding = {};
+  binding.texture                      = g_data.font_atlas;
+  binding.sampler                      = g_data.linear_sampler;
+
+  uint32_t region_offset = g_data.data_region_index * g_data.text_ring.region_size;
+  uniforms.text_msdf     = g_data.font_type == IM3D_SDL3_GPU_FONT_TYPE_MSDF;
+
+  SDL_GPUGraphicsPipeline* bound_pipeline = nullptr;
+  for (uint32_t i = 0; i < g_data.text_draw_count; i++) {
+    const Text_Draw&         draw = g_data.text_draws[i];
+    SDL_GPUGraphicsPipeline* pipeline =
+        graphics_pipeline(target_pipelines, GRAPHICS_PIPELINE_TEXT, draw.depth_state);
+    if (pipeline == nullptr) { continue; }
+    if (pipeline != bound_pipeline) {
+      SDL_BindGPUGraphicsPipeline(render_pass, pipeline);
+      SDL_BindGPUFragmentSamplers(render_pass, 0, &binding, 1);
+      bound_pipeline = pipeline;
+    }
+
+    uniforms.text_offset = region_offset / sizeof(Glyph_Instance) + draw.first_instance;
+    SDL_PushGPUVertexUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+    SDL_DrawGPUPrimitives(render_pass, 4, draw.instance_count, 0, 0);
+  }
+}
+
+// Everything but text, which render_text draws separately.
+static bool has_draws() {
+  return g_data.draw_batch_count > 0 || g_data.mesh_instance_ring.size > 0 ||
+         g_data.shape_draw_count > 0 || g_data.impostor_draw_count > 0;
+}
+
+static uint64_t overlay_target_size(uint32_t width, uint32_t height) {
+  return SDL_CalculateGPUTextureFormatSize(g_data.init_info.color_target_format, width, height, 1);
+}
+
+// The overlay target is only recreated when the viewport changes size, the dynamic scale changes
+// how much of it is drawn into.
+static bool reserve_overlay_target(uint32_t width, uint32_t height) {
+  if (g_data.overlay_width == width && g_data.overlay_height == height) { return true; }
+
+  int64_t size_new = int64_t(overlay_target_size(width, height));
+  int64_t size_old = int64_t(overlay_target_size(g_data.overlay_width, g_data.overlay_height));
+  if (!within_memory_budget(size_new - size_old, "overlay")) { return false; }
+
+  SDL_GPUTextureCreateInfo info = {};
+  info.type                     = SDL_GPU_TEXTURETYPE_2D;
+  info.format                   = g_data.init_info.color_target_format;
+  info.usage                = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER;
+  info.width                = width;
+  info.height               = height;
+  info.layer_count_or_depth = 1;
+  info.num_levels           = 1;
+  info.sample_count         = SDL_GPU_SAMPLECOUNT_1;
+  SDL_GPUTexture* texture   = SDL_CreateGPUTexture(g_data.init_info.device, &info);
+  if (texture == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to create overlay texture: %s",
+        SDL_GetError());
+    return false;
+  }
+
+  // Frames in flight keep the released target alive until they complete.
+  SDL_ReleaseGPUTexture(g_data.init_info.device, g_data.overlay_texture);
+  track_memory(size_new - size_old);
+
+  g_data.overlay_texture = texture;
+  g_data.overlay_width   = width;
+  g_data.overlay_height  = height;
+  return true;
+}
+
+// Creates the unit shapes of Im3d_SDL3_GPU_Builtin_Mesh, in order so that their ids match.
+static bool create_builtin_meshes() {
+  static constexpr int SPHERE_DETAIL  = 32;
+  static constexpr int SPHERE_RINGS   = 16;
+  static constexpr int MAX_VERTICES   = SPHERE_DETAIL * SPHERE_RINGS * 6;
+  static constexpr int BOX_EDGES[][2] = {
+      {0, 1}, {2, 3}, {4, 5}, {6, 7}, {0, 2}, {1, 3},
+      {4, 6}, {5, 7}, {0, 4}, {1, 5}, {2, 6}, {3, 7},
+  };
+  static constexpr int BOX_FACES[][4] = {
+      {0, 2, 6, 4}, {1, 5, 7, 3}, {0, 4, 5, 1}, {2, 3, 7, 6}, {0, 1, 3, 2}, {4, 6, 7, 5},
+  };
+
+  auto vertices = static_cast<Im3d::Vec4*>(SDL_malloc(MAX_VERTICES * sizeof(Im3d::Vec4)));
+  if (vertices == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate builtin mesh vertices");
+    return false;
+  }
+  auto box_corner = [](int i) {
+    return Im3d::Vec4(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f, 1.0f);
+  };
+  auto sphere_point = [](int ring, int column) {
+    float theta = Im3d::Pi * float(ring) / float(SPHERE_RINGS);
+    float phi   = Im3d::TwoPi * float(column) / float(SPHERE_DETAIL);
+    return Im3d::Vec4(
+        SDL_sinf(theta) * SDL_cosf(phi),
+        SDL_cosf(theta),
+        SDL_sinf(theta) * SDL_sinf(phi),
+        1.0f);
+  };
+
+  Im3d_SDL3_GPU_Mesh mesh_ids[5] = {};
+  uint32_t           count       = 0;
+
+  // The xy, xz and yz circles of Im3d::DrawSphere.
+  for (int axis = 0; axis < 3; axis++) {
+    for (int i = 0; i < SPHERE_DETAIL; i++) {
+      for (int j = i; j <= i + 1; j++) {
+        float c = SDL_cosf(Im3d::TwoPi * float(j) / float(SPHERE_DETAIL));
+        float s = SDL_sinf(Im3d::TwoPi * float(j) / float(SPHERE_DETAIL));
+        if (axis == 0) {
+          vertices[count++] = Im3d::Vec4(c, s, 0.0f, 1.0f);
+        } else if (axis == 1) {
+          vertices[count++] = Im3d::Vec4(c, 0.0f, s, 1.0f);
+        } else {
+          vertices[count++] = Im3d::Vec4(0.0f, c, s, 1.0f);
+        }
+      }
+    }
+  }
+  mesh_ids[0] = im3d_sdl3_gpu_create_mesh(IM3D_SDL3_GPU_MESH_TYPE_LINES, vertices, count);
+
+  count = 0;
+  for (const auto& edge : BOX_EDGES) {
+    vertices[count++] = box_corner(edge[0]);
+    vertices[count++] = box_corner(edge[1]);
+  }
+  mesh_ids[1] = im3d_sdl3_gpu_create_mesh(IM3D_SDL3_GPU_MESH_TYPE_LINES, vertices, count);
+
+  // Like Im3d::DrawArrow the head is a line twice as thick, tapering to the tip.
+  vertices[0] = Im3d::Vec4(0.0f, 0.0f, 0.0f, 1.0f);
+  vertices[1] = Im3d::Vec4(0.0f, 0.0f, 0.75f, 1.0f);
+  vertices[2] = Im3d::Vec4(0.0f, 0.0f, 0.75f, 2.0f);
+  vertices[3] = Im3d::Vec4(0.0f, 0.0f, 1.0f, 0.0f);
+  mesh_ids[2] = im3d_sdl3_gpu_create_mesh(IM3D_SDL3_GPU_MESH_TYPE_LINES, vertices, 4);
+
+  // The pole rings have a single triangle per column.
+  count = 0;
+  for (int ring = 0; ring < SPHERE_RINGS; ring++) {
+    for (int column = 0; column < SPHERE_DETAIL; column++) {
+      Im3d::Vec4 a = sphere_point(ring, column);
+      Im3d::Vec4 b = sphere_point(ring, column + 1);
+      Im3d::Vec4 c = sphere_point(ring + 1, column);
+      Im3d::Vec4 d = sphere_point(ring + 1, column + 1);
+      if (ring > 0) {
+        vertices[count++] = a;
+        vertices[count++] = b;
+        vertices[count++] = d;
+      }
+      if (ring < SPHERE_RINGS - 1) {
+        vertices[count++] = a;
+        vertices[count++] = d;
+        vertices[count++] = c;
+      }
+    }
+  }
+  mesh_ids[3] = im3d_sdl3_gpu_create_mesh(IM3D_SDL3_GPU_MESH_TYPE_TRIANGLES, vertices, count);
+
+  count = 0;
+  for (const auto& face : BOX_FACES) {
+    vertices[count++] = box_corner(face[0]);
+    vertices[count++] = box_corner(face[1]);
+    vertices[count++] = box_corner(face[2]);
+    vertices[count++] = box_corner(face[0]);
+    vertices[count++] = box_corner(face[2]);
+    vertices[count++] = box_corner(face[3]);
+  }
+  mesh_ids[4] = im3d_sdl3_gpu_create_mesh(IM3D_SDL3_GPU_MESH_TYPE_TRIANGLES, vertices, count);
+
+  SDL_free(vertices);
+  for (uint32_t i = 0; i < SDL_arraysize(mesh_ids); i++) {
+    if (mesh_ids[i] != IM3D_SDL3_GPU_MESH_SPHERE + i) { return false; }
+  }
+  return true;
+}
+
+// Draws this frame's draw data into the viewport_size pixels at the top left of render_pass, which
+// are the whole viewport unless drawing into the overlay target. Sizes stay in viewport pixels.
+static void render_draw_lists(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass*    render_pass,
+    Target_Pipelines&     target_pipelines,
+    Im3d::Vec2            viewport_size) {
+  const Im3d::AppData& app_data = Im3d::GetAppData();
+
+  {
+    SDL_GPUBufferBinding binding = {};
+    binding.buffer               = g_data.vertex_buffer;
+    SDL_BindGPUVertexBuffers(render_pass, 0, &binding, 1);
+  }
+
+  Vertex_Uniforms uniforms         = {};
+  uniforms.world_to_clip_transform = g_data.world_to_clip_transform;
+  uniforms.clip_to_world_transform = g_data.clip_to_world_transform;
+  uniforms.resolution              = app_data.m_viewportSize;
+  uniforms.vertex_packed = g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_PACKED;
+  uniforms.triangle_antialiasing =
+      target_pipelines.target.sample_count == SDL_GPU_SAMPLECOUNT_1;
+
+  {
+    SDL_GPUViewport viewport = {};
+    viewport.w               = viewport_size.x;
+    viewport.h               = viewport_size.y;
+    viewport.min_depth       = 0.0f;
+    viewport.max_depth       = 1.0f;
+    SDL_SetGPUViewport(render_pass, &viewport);
+  }
+
+  if (g_data.impostor_draw_count > 0) {
+    render_impostors(command_buffer, render_pass, target_pipelines, uniforms);
+  }
+  if (g_data.mesh_instance_ring.size > 0) {
+    render_mesh_instances(command_buffer, render_pass, target_pipelines, uniforms);
+  }
+  if (g_data.shape_draw_count > 0) {
+    render_shapes(command_buffer, render_pass, target_pipelines, uniforms);
+  }
+
+  // The uniforms only select the batch's segments, the draw itself is fetched from the draw buffer,
+  // or from the cull buffer which also holds the visible instances when gpu_culling reserved it.
+  uint32_t draw_region_offset = g_data.data_region_index * draw_region_size(g_data.draw_capacity);
+
+  SDL_GPUBuffer* indirect_buffer = g_data.draw_buffer;
+  uint32_t       command_offset  = draw_region_offset + g_data.draw_capacity * sizeof(Draw_Segment);
+  if (g_data.cull_commands) {
+    indirect_buffer = g_data.cull_buffer;
+    command_offset  = g_data.data_region_index * cull_region_size();
+  }
+
+  // Batches which don't remap their instances still need a buffer bound for the instance indices.
+  SDL_GPUBuffer*           bound_buffers[2] = {};
+  SDL_GPUGraphicsPipeline* bound_pipeline   = nullptr;
+  for (uint32_t i = 0; i < g_data.draw_batch_count; i++) {
+    const Draw_Batch& batch   = g_data.draw_batches[i];
+    bool              indexed = batch.prim_type == Im3d::DrawPrimitive_IndexedTriangles;
+    if (indexed && batch.index_count == 0) { continue; }
+
+    SDL_GPUBuffer* instance_buffer = g_data.draw_buffer;
+    if (batch.culled) {
+      instance_buffer = g_data.cull_buffer;
+    } else if (batch.gpu_sorted) {
+      instance_buffer = g_data.sort_buffer;
+    }
+    if (batch.vertex_data_buffer != bound_buffers[0] || instance_buffer != bound_buffers[1]) {
+      SDL_GPUBuffer* storage_buffers[] = {
+          batch.vertex_data_buffer,
+          g_data.draw_buffer,
+          instance_buffer,
+      };
+      SDL_BindGPUVertexStorageBuffers(render_pass, 0, storage_buffers, 3);
+      bound_buffers[0] = batch.vertex_data_buffer;
+      bound_buffers[1] = instance_buffer;
+    }
+
+    Graphics_Pipeline_Kind kind;
+    switch (batch.prim_type) {
+    case Im3d::DrawPrimitive_Points:
+      kind = GRAPHICS_PIPELINE_POINTS;
+      break;
+    case Im3d::DrawPrimitive_Lines:
+    case Im3d::DrawPrimitive_LineStrip:
+      kind = GRAPHICS_PIPELINE_LINES;
+      break;
+    case Im3d::DrawPrimitive_Triangles:
+    case Im3d::DrawPrimitive_TriangleStrip:
+      kind = GRAPHICS_PIPELINE_TRIANGLES;
+      break;
+    case Im3d::DrawPrimitive_IndexedTriangles:
+      kind = GRAPHICS_PIPELINE_INDEXED_TRIANGLES;
+      break;
+    default:
+      SDL_assert(false);
+      return;
+    }
+    SDL_GPUGraphicsPipeline* prim_pipeline =
+        graphics_pipeline(target_pipelines, kind, batch.depth_state);
+    if (prim_pipeline == nullptr) { continue; }
+    if (prim_pipeline != bound_pipeline) {
+      SDL_BindGPUGraphicsPipeline(render_pass, prim_pipeline);
+      bound_pipeline = prim_pipeline;
+    }
+
+    set_batch_uniforms(uniforms, i);
+    SDL_PushGPUVertexUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+
+    // The vertex ids of an indexed draw are the indices, relative to the batch's only segment.
+    if (indexed) {
+      SDL_GPUBufferBinding binding = {};
+      binding.buffer               = g_data.index_ring.buffer;
+      binding.offset               = g_data.data_region_index * g_data.index_ring.region_size;
+      SDL_BindGPUIndexBuffer(
+          render_pass,
+          &binding,
+          batch.index_16bit ? SDL_GPU_INDEXELEMENTSIZE_16BIT : SDL_GPU_INDEXELEMENTSIZE_32BIT);
+      uint32_t first_index = batch.index_offset / (batch.index_16bit ? 2 : 4);
+      SDL_DrawGPUIndexedPrimitives(render_pass, batch.index_count, 1, first_index, 0, 0);
+      continue;
+    }
+
+    SDL_DrawGPUPrimitivesIndirect(
+        render_pass,
+        indirect_buffer,
+        command_offset + i * sizeof(SDL_GPUIndirectDrawCommand),
+        1);
+  }
+}
+
+// Draws into the top left of the overlay target at the current overlay scale, in a render pass of
+// its own. The target starts transparent and ends up holding premultiplied colors.
+static void render_overlay(SDL_GPUCommandBuffer* command_buffer) {
+  const Im3d::AppData& app_data = Im3d::GetAppData();
+  if (app_data.m_viewportSize.x <= 0.0f || app_data.m_viewportSize.y <= 0.0f) { return; }
+  if (!has_draws()) { return; }
+
+  uint32_t width  = uint32_t(SDL_ceilf(app_data.m_viewportSize.x * g_data.init_info.overlay_scale));
+  uint32_t height = uint32_t(SDL_ceilf(app_data.m_viewportSize.y * g_data.init_info.overlay_scale));
+  if (!reserve_overlay_target(width, height)) { return; }
+
+  // Single sampled, its triangles are antialiased analytically instead.
+  Im3d_SDL3_GPU_Render_Target target = {};
+  target.color_format                = g_data.init_info.color_target_format;
+  target.sample_count                = SDL_GPU_SAMPLECOUNT_1;
+  target.depth_stencil_format        = SDL_GPU_TEXTUREFORMAT_INVALID;
+  target.blend_mode                  = IM3D_SDL3_GPU_BLEND_MODE_PREMULTIPLIED;
+  Target_Pipelines* target_pipelines = find_target_pipelines(target);
+  if (target_pipelines == nullptr) {
+    SDL_assert(false);
+    return;
+  }
+
+  Im3d::Vec2 draw_size;
+  draw_size.x = SDL_min(SDL_ceilf(app_data.m_viewportSize.x * g_data.overlay_scale), float(width));
+  draw_size.y = SDL_min(SDL_ceilf(app_data.m_viewportSize.y * g_data.overlay_scale), float(height));
+
+  SDL_GPUColorTargetInfo target_info = {};
+  target_info.texture                = g_data.overlay_texture;
+  target_info.clear_color            = {0.0f, 0.0f, 0.0f, 0.0f};
+  target_info.load_op                = SDL_GPU_LOADOP_CLEAR;
+  target_info.store_op               = SDL_GPU_STOREOP_STORE;
+
+  SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(command_buffer, &target_info, 1, nullptr);
+  render_draw_lists(command_buffer, render_pass, *target_pipelines, draw_size);
+  SDL_EndGPURenderPass(render_pass);
+
+  g_data.overlay_draw_size = draw_size;
+}
+
+// Upsamples the drawn area of the overlay target over the whole viewport with bilinear filtering.
+static void composite_overlay(
+    SDL_GPUCommandBuffer* command_buffer,
+    SDL_GPURenderPass*    render_pass,
+    Target_Pipelines&     target_pipelines) {
+  const Im3d::AppData& app_data = Im3d::GetAppData();
+
+  Vertex_Uniforms uniforms          = {};
+  uniforms.overlay_texcoord_scale.x = g_data.overlay_draw_size.x / float(g_data.overlay_width);
+  uniforms.overlay_texcoord_scale.y = g_data.overlay_draw_size.y / float(g_data.overlay_height);
+
+  {
+    SDL_GPUViewport viewport = {};
+    viewport.w               = app_data.m_viewportSize.x;
+    viewport.h               = app_data.m_viewportSize.y;
+    viewport.min_depth       = 0.0f;
+    viewport.max_depth       = 1.0f;
+    SDL_SetGPUViewport(render_pass, &viewport);
+  }
+
+  SDL_GPUTextureSamplerBinding binding = {};
+  binding.texture                      = g_data.overlay_texture;
+  binding.sampler                      = g_data.linear_sampler;
+
+  SDL_GPUGraphicsPipeline* pipeline =
+      graphics_pipeline(target_pipelines, GRAPHICS_PIPELINE_OVERLAY, DEPTH_STATE_OFF);
+  if (pipeline == nullptr) { return; }
+  SDL_BindGPUGraphicsPipeline(render_pass, pipeline);
+  SDL_BindGPUFragmentSamplers(render_pass, 0, &binding, 1);
+  SDL_PushGPUVertexUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+  SDL_DrawGPUPrimitives(render_pass, 3, 1, 0, 0);
+}
+
+bool im3d_sdl3_gpu_init(const Im3d_SDL3_GPU_Init_Info& info) {
+  SDL_assert(info.device != nullptr);
+
+  // The overlay has no copy of the render pass's depth, the scene couldn't hide anything in it.
+  if (info.overlay_scale > 0.0f && info.depth_stencil_format != SDL_GPU_TEXTUREFORMAT_INVALID) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "overlay_scale can't be used with a depth_stencil_format");
+    return false;
+  }
+
+  g_data.init_info = info;
+
+  // The data and transfer buffers are split into one region per frame in flight plus one for the
+  // frame currently being recorded, so the CPU never writes a region the GPU may still be reading.
+  uint32_t frames_in_flight =
+      info.frames_in_flight > 0 ? info.frames_in_flight : DEFAULT_FRAMES_IN_FLIGHT;
+  g_data.data_region_count = frames_in_flight + 1;
+
+  g_data.vertex_stride = info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_PACKED
+                             ? sizeof(Packed_Vertex_Data)
+                             : sizeof(Im3d::VertexData);
+
+  g_data.overlay_scale = info.overlay_scale;
+
+  {
+    // Only the formats embedded by the build are looked for, see im3d_sdl3_gpu_shaders.h.
+    const char*         driver        = SDL_GetGPUDeviceDriver(g_data.init_info.device);
+    SDL_GPUShaderFormat shader_format = SDL_GPU_SHADERFORMAT_INVALID;
+    Shader_Pack         shader_pack   = {};
+#ifdef IM3D_SDL3_GPU_SHADERS_SPIRV
+    if (SDL_strcmp(driver, "vulkan") == 0) {
+      shader_format = SDL_GPU_SHADERFORMAT_SPIRV;
+      shader_pack   = {
+          im3d_shader_pack_spv,
+          im3d_shader_table_spv,
+          SDL_arraysize(im3d_shader_table_spv),
+      };
+    }
+#endif
+#ifdef IM3D_SDL3_GPU_SHADERS_DXIL
+    if (SDL_strcmp(driver, "direct3d12") == 0) {
+      shader_format = SDL_GPU_SHADERFORMAT_DXIL;
+      shader_pack   = {
+          im3d_shader_pack_dxil,
+          im3d_shader_table_dxil,
+          SDL_arraysize(im3d_shader_table_dxil),
+      };
+    }
+#endif
+#ifdef IM3D_SDL3_GPU_SHADERS_MSL
+    // TODO: Add metallib shaders.
+    if (SDL_strcmp(driver, "metal") == 0 &&
+        (SDL_GetGPUShaderFormats(g_data.init_info.device) & SDL_GPU_SHADERFORMAT_MSL)) {
+      shader_format = SDL_GPU_SHADERFORMAT_MSL;
+      shader_pack   = {
+          im3d_shader_pack_msl,
+          im3d_shader_table_msl,
+          SDL_arraysize(im3d_shader_table_msl),
+      };
+    }
+#endif
+    if (shader_format == SDL_GPU_SHADERFORMAT_INVALID) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Im3d SDL3 GPU backend was not built with shaders for the %s GPU device driver, "
+          "run 'build shaders' to compile them into im3d_sdl3_gpu_shaders.h",
+          driver);
+      return false;
+    }
+
+    // Pipelines are created the first time they are drawn with, so startup doesn't pay for the
+    // primitive types an app never draws. Indexed triangles, mesh triangles and the overlay have no
+    // vertex buffer, their vertex ids index the data they read.
+    g_data.shader_format          = shader_format;
+    g_data.shader_pack            = shader_pack;
+    Graphics_Pipeline_Desc* descs = g_data.graphics_pipeline_descs;
+    descs[GRAPHICS_PIPELINE_POINTS] = {
+        "points",
+        "im3d_points.vert",
+        "im3d_points.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP,
+        true,
+        false,
+    };
+    descs[GRAPHICS_PIPELINE_LINES] = {
+        "lines",
+        "im3d_lines.vert",
+        "im3d_lines.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP,
+        true,
+        false,
+    };
+    descs[GRAPHICS_PIPELINE_TRIANGLES] = {
+        "triangles",
+        "im3d_triangles.vert",
+        "im3d_triangles.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        true,
+        false,
+    };
+    descs[GRAPHICS_PIPELINE_INDEXED_TRIANGLES] = {
+        "indexed triangles",
+        "im3d_indexed_triangles.vert",
+        "im3d_triangles.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        false,
+        false,
+    };
+    descs[GRAPHICS_PIPELINE_MESH_LINES] = {
+        "mesh lines",
+        "im3d_mesh_lines.vert",
+        "im3d_lines.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP,
+        true,
+        false,
+    };
+    descs[GRAPHICS_PIPELINE_MESH_TRIANGLES] = {
+        "mesh triangles",
+        "im3d_mesh_triangles.vert",
+        "im3d_triangles.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        false,
+        false,
+    };
+    descs[GRAPHICS_PIPELINE_SHAPES] = {
+        "shapes",
+        "im3d_shapes.vert",
+        "im3d_lines.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP,
+        true,
+        false,
+    };
+    descs[GRAPHICS_PIPELINE_IMPOSTORS] = {
+        "impostors",
+        "im3d_impostors.vert",
+        "im3d_impostors.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP,
+        true,
+        false,
+    };
+    descs[GRAPHICS_PIPELINE_TEXT] = {
+        "text",
+        "im3d_text.vert",
+        "im3d_text.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLESTRIP,
+        true,
+        true,
+    };
+    descs[GRAPHICS_PIPELINE_OVERLAY] = {
+        "overlay",
+        "im3d_overlay.vert",
+        "im3d_overlay.frag",
+        SDL_GPU_PRIMITIVETYPE_TRIANGLELIST,
+        false,
+        true,
+    };
 
-    // Triangles pipeline.
-    {
-      SDL_GPUShader* vertex_shader;
-      {
-        SDL_GPUShaderCreateInfo info = {};
-        info.code                    = shader_triangles_vert_data;
-        info.code_size               = shader_triangles_vert_size;
-        info.entrypoint              = "main";
-        info.format                  = shader_format;
-        info.num_storage_buffers     = 1;
-        info.num_uniform_buffers     = 1;
-        info.stage                   = SDL_GPU_SHADERSTAGE_VERTEX;
-        vertex_shader                = SDL_CreateGPUShader(g_data.init_info.device, &info);
-        if (vertex_shader == nullptr) {
-          SDL_LogError(
-              SDL_LOG_CATEGORY_APPLICATION,
-              "Failed to create triangles vertex shader: %s",
-              SDL_GetError());
-          return false;
-        }
-      }
+    Compute_Pipeline_Desc* compute_descs = g_data.compute_pipeline_descs;
+    compute_descs[COMPUTE_PIPELINE_CULL] = {
+        "cull",
+        "im3d_cull.comp",
+        2,
+        CULL_THREAD_COUNT,
+    };
+    compute_descs[COMPUTE_PIPELINE_SORT_KEYS] = {
+        "sort keys",
+        "im3d_sort_keys.comp",
+        2,
+        SORT_GROUP_SIZE,
+    };
+    compute_descs[COMPUTE_PIPELINE_SORT_COUNT] = {
+        "sort count",
+        "im3d_sort_count.comp",
+        0,
+        SORT_GROUP_SIZE,
+    };
+    compute_descs[COMPUTE_PIPELINE_SORT_SCAN] = {
+        "sort scan",
+        "im3d_sort_scan.comp",
+        0,
+        SORT_GROUP_SIZE,
+    };
+    compute_descs[COMPUTE_PIPELINE_SORT_SCATTER] = {
+        "sort scatter",
+        "im3d_sort_scatter.comp",
+        0,
+        SORT_GROUP_SIZE,
+    };
+  }
 
-      SDL_GPUShader* fragment_shader;
-      {
-        SDL_GPUShaderCreateInfo info = {};
-        info.code                    = shader_triangles_frag_data;
-        info.code_size               = shader_triangles_frag_size;
-        info.entrypoint              = "main";
-        info.format                  = shader_format;
-        info.stage                   = SDL_GPU_SHADERSTAGE_FRAGMENT;
-        fragment_shader              = SDL_CreateGPUShader(g_data.init_info.device, &info);
-        if (fragment_shader == nullptr) {
-          SDL_LogError(
-              SDL_LOG_CATEGORY_APPLICATION,
-              "Failed to create triangles fragment shader: %s",
-              SDL_GetError());
-          return false;
-        }
-      }
+  // Sorted primitives are emitted per layer and primitive type and sorted by sort_draw_batches.
+  Im3d::GetContext().setSortingDeferred(g_data.init_info.gpu_sorting);
+  Im3d::GetContext().setNativeStrips(true);
+  Im3d::GetContext().setNativeIndices(true);
 
-      SDL_GPUGraphicsPipelineCreateInfo info = pipeline_info;
-      info.vertex_shader                     = vertex_shader;
-      info.fragment_shader                   = fragment_shader;
-      g_data.pipeline_triangles = SDL_CreateGPUGraphicsPipeline(g_data.init_info.device, &info);
-      if (g_data.pipeline_triangles == nullptr) {
-        SDL_LogError(
-            SDL_LOG_CATEGORY_APPLICATION,
-            "Failed to create triangles pipeline: %s",
-            SDL_GetError());
-        return false;
-      }
+#ifdef IM3D_GIZMO_LAYER_ID
+  // Gizmos stay visible inside the shapes they manipulate.
+  im3d_sdl3_gpu_set_layer_depth_mode(IM3D_GIZMO_LAYER_ID, IM3D_SDL3_GPU_DEPTH_MODE_OFF);
+#endif
 
-      SDL_ReleaseGPUShader(g_data.init_info.device, vertex_shader);
-      SDL_ReleaseGPUShader(g_data.init_info.device, fragment_shader);
-    }
-  }
+  if (!create_builtin_meshes()) { return false; }
 
-  // Upload vertex data to vertex_buffer.
+  // The quad is copied to vertex_buffer by the first copy pass instead of waiting for the GPU here.
   {
     Im3d::Vec4 vertex_data[] = {
         Im3d::Vec4(-1.0f, -1.0f, 0.0f, 1.0f),
@@ -319,15 +3940,15 @@ bool im3d_sdl3_gpu_init(const Im3d_SDL3_GPU_Init_Info& info) {
             SDL_GetError());
         return false;
       }
+      track_memory(vertex_data_size);
     }
 
-    SDL_GPUTransferBuffer* transfer_buffer;
     {
       SDL_GPUTransferBufferCreateInfo info = {};
       info.size                            = vertex_data_size;
       info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-      transfer_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
-      if (transfer_buffer == nullptr) {
+      g_data.vertex_upload_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
+      if (g_data.vertex_upload_buffer == nullptr) {
         SDL_LogError(
             SDL_LOG_CATEGORY_APPLICATION,
             "Failed to create vertex transfer buffer: %s",
@@ -337,7 +3958,8 @@ bool im3d_sdl3_gpu_init(const Im3d_SDL3_GPU_Init_Info& info) {
     }
 
     {
-      void* mapped_data = SDL_MapGPUTransferBuffer(g_data.init_info.device, transfer_buffer, false);
+      void* mapped_data =
+          SDL_MapGPUTransferBuffer(g_data.init_info.device, g_data.vertex_upload_buffer, false);
       if (mapped_data == nullptr) {
         SDL_LogError(
             SDL_LOG_CATEGORY_APPLICATION,
@@ -346,40 +3968,119 @@ bool im3d_sdl3_gpu_init(const Im3d_SDL3_GPU_Init_Info& info) {
         return false;
       }
       SDL_memcpy(mapped_data, vertex_data, vertex_data_size);
-      SDL_UnmapGPUTransferBuffer(g_data.init_info.device, transfer_buffer);
+      SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.vertex_upload_buffer);
     }
+  }
 
-    SDL_GPUCommandBuffer* command_buffer = SDL_AcquireGPUCommandBuffer(g_data.init_info.device);
-    {
-      SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
-
-      SDL_GPUTransferBufferLocation location = {};
-      location.transfer_buffer               = transfer_buffer;
-
-      SDL_GPUBufferRegion buffer_region = {};
-      buffer_region.buffer              = g_data.vertex_buffer;
-      buffer_region.size                = vertex_data_size;
+  {
+    SDL_GPUSamplerCreateInfo sampler_info = {};
+    sampler_info.min_filter               = SDL_GPU_FILTER_LINEAR;
+    sampler_info.mag_filter               = SDL_GPU_FILTER_LINEAR;
+    sampler_info.mipmap_mode              = SDL_GPU_SAMPLERMIPMAPMODE_NEAREST;
+    sampler_info.address_mode_u           = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+    sampler_info.address_mode_v           = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+    sampler_info.address_mode_w           = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
+    g_data.linear_sampler = SDL_CreateGPUSampler(g_data.init_info.device, &sampler_info);
+    if (g_data.linear_sampler == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create sampler: %s",
+          SDL_GetError());
+      return false;
+    }
+  }
 
-      SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
-      SDL_EndGPUCopyPass(copy_pass);
+  // The copy threads are started last so that no other init step can fail while they run. A
+  // failure here joins the threads that were already started.
+  if (info.copy_thread_count > 0) {
+    g_data.copy_start_semaphore = SDL_CreateSemaphore(0);
+    g_data.copy_done_semaphore  = SDL_CreateSemaphore(0);
+    if (g_data.copy_start_semaphore == nullptr || g_data.copy_done_semaphore == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create copy semaphores: %s",
+          SDL_GetError());
+      destroy_copy_threads();
+      return false;
     }
-    SDL_SubmitGPUCommandBuffer(command_buffer);
 
-    SDL_WaitForGPUIdle(g_data.init_info.device);
-    SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, transfer_buffer);
+    uint32_t thread_count = SDL_min(info.copy_thread_count, MAX_COPY_THREADS);
+    for (uint32_t i = 0; i < thread_count; i++) {
+      g_data.copy_threads[i] = SDL_CreateThread(copy_thread_main, "im3d_copy", nullptr);
+      if (g_data.copy_threads[i] == nullptr) {
+        SDL_LogError(
+            SDL_LOG_CATEGORY_APPLICATION,
+            "Failed to create copy thread: %s",
+            SDL_GetError());
+        destroy_copy_threads();
+        return false;
+      }
+      g_data.copy_thread_count++;
+    }
   }
 
   return true;
 }
 
 void im3d_sdl3_gpu_shutdown() {
-  SDL_ReleaseGPUGraphicsPipeline(g_data.init_info.device, g_data.pipeline_points);
-  SDL_ReleaseGPUGraphicsPipeline(g_data.init_info.device, g_data.pipeline_lines);
-  SDL_ReleaseGPUGraphicsPipeline(g_data.init_info.device, g_data.pipeline_triangles);
+  unmap_transfer_buffers();
+  destroy_copy_threads();
+
+  for (uint32_t i = 0; i < g_data.target_pipeline_count; i++) {
+    const Target_Pipelines& target_pipelines = g_data.target_pipelines[i];
+    for (uint32_t j = 0; j < GRAPHICS_PIPELINE_KIND_COUNT; j++) {
+      for (uint32_t k = 0; k < DEPTH_STATE_COUNT; k++) {
+        SDL_ReleaseGPUGraphicsPipeline(g_data.init_info.device, target_pipelines.pipelines[j][k]);
+      }
+    }
+  }
+  for (uint32_t i = 0; i < COMPUTE_PIPELINE_KIND_COUNT; i++) {
+    SDL_ReleaseGPUComputePipeline(g_data.init_info.device, g_data.compute_pipelines[i]);
+  }
 
   SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.vertex_buffer);
+  SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.vertex_upload_buffer);
   SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.data_buffer);
   SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.transfer_buffer);
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.resident_buffer);
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.retired_resident_buffer);
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.draw_buffer);
+  SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.draw_transfer_buffer);
+  release_upload_ring(g_data.index_ring);
+  release_upload_ring(g_data.mesh_instance_ring);
+  release_upload_ring(g_data.shape_ring);
+  release_upload_ring(g_data.impostor_ring);
+  release_upload_ring(g_data.text_ring);
+  release_font();
+  release_text_runs();
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.cull_buffer);
+  SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.sort_buffer);
+  SDL_ReleaseGPUSampler(g_data.init_info.device, g_data.linear_sampler);
+  SDL_ReleaseGPUTexture(g_data.init_info.device, g_data.overlay_texture);
+
+  SDL_free(g_data.draw_list_infos);
+  SDL_free(g_data.copy_jobs);
+  SDL_free(g_data.upload_ranges);
+  SDL_free(g_data.layer_infos);
+  for (uint32_t i = 0; i < g_data.retained_layer_count; i++) {
+    release_retained_layer(g_data.retained_layers[i]);
+  }
+  SDL_free(g_data.retained_layers);
+  for (uint32_t i = 0; i < g_data.mesh_count; i++) {
+    release_mesh(g_data.meshes[i]);
+  }
+  SDL_free(g_data.meshes);
+  SDL_free(g_data.shapes);
+  release_depth_runs(g_data.shape_runs);
+  release_depth_runs(g_data.shape_draw_runs);
+  SDL_free(g_data.impostors);
+  release_depth_runs(g_data.impostor_runs);
+  release_depth_runs(g_data.impostor_draw_runs);
+  SDL_free(g_data.text_draws);
+  SDL_free(g_data.draw_batches);
+  SDL_free(g_data.draw_order);
+
+  g_data = {};
 }
 
 void im3d_sdl3_gpu_new_frame(const Im3d_SDL3_GPU_Frame_Info& info) {
@@ -425,6 +4126,7 @@ void im3d_sdl3_gpu_new_frame(const Im3d_SDL3_GPU_Frame_Info& info) {
   }
 
   g_data.world_to_clip_transform = info.view_to_clip_transform * info.world_to_view_transform;
+  g_data.clip_to_world_transform = Im3d::Inverse(g_data.world_to_clip_transform);
   app_data.setCullFrustum(g_data.world_to_clip_transform, false);
 
   app_data.m_keyDown[Im3d::Action_Select] = (mouse_button_state & SDL_BUTTON_LMASK) != 0;
@@ -440,98 +4142,246 @@ void im3d_sdl3_gpu_new_frame(const Im3d_SDL3_GPU_Frame_Info& info) {
   app_data.m_snapTranslation = ctrl_down ? 0.1f : 0.0f;
   app_data.m_snapRotation    = ctrl_down ? Im3d::Radians(30.0f) : 0.0f;
   app_data.m_snapScale       = ctrl_down ? 0.5f : 0.0f;
+
+  if (g_data.init_info.overlay_frame_budget > 0.0f && info.delta_time > 0.0f) {
+    float budget = g_data.init_info.overlay_frame_budget;
+    if (info.delta_time > budget) {
+      g_data.overlay_scale *= OVERLAY_SCALE_DECAY;
+    } else if (info.delta_time < budget * OVERLAY_BUDGET_HEADROOM) {
+      g_data.overlay_scale += OVERLAY_SCALE_RECOVERY;
+    }
+    float min_scale = g_data.init_info.overlay_min_scale > 0.0f ? g_data.init_info.overlay_min_scale
+                                                                 : DEFAULT_OVERLAY_MIN_SCALE;
+    min_scale            = SDL_min(min_scale, g_data.init_info.overlay_scale);
+    g_data.overlay_scale =
+        SDL_clamp(g_data.overlay_scale, min_scale, g_data.init_info.overlay_scale);
+  }
+
+  // The vertex arena is picked up by Im3d::NewFrame, the first frame allocates the ring.
+  if (g_data.init_info.zero_copy_emission &&
+      g_data.init_info.vertex_format == IM3D_SDL3_GPU_VERTEX_FORMAT_FULL &&
+      g_data.transfer_buffer != nullptr) {
+    begin_vertex_emission();
+  }
 }
 
 void im3d_sdl3_gpu_prepare_draw_data(SDL_GPUCommandBuffer* command_buffer) {
   SDL_assert(g_data.init_info.device != nullptr);
   SDL_assert(command_buffer != nullptr);
 
-  g_data.total_vertex_count = 0;
-  for (uint32_t i = 0; i < Im3d::GetDrawListCount(); i++) {
-    g_data.total_vertex_count += Im3d::GetDrawLists()[i].m_vertexCount;
-  }
+  g_data.total_vertex_count                = 0;
+  g_data.draw_batch_count                  = 0;
+  g_data.index_ring.size                   = 0;
+  g_data.mesh_instance_ring.size           = 0;
+  g_data.shape_ring.size                   = 0;
+  g_data.impostor_ring.size                = 0;
+  g_data.text_ring.size                    = 0;
+  g_data.memory_stats.dropped_vertex_count = 0;
+  g_data.overlay_draw_size                 = Im3d::Vec2(0.0f, 0.0f);
+  g_data.frame_index++;
 
-  const Im3d::AppData& app_data = Im3d::GetAppData();
-  if (app_data.m_viewportSize.x <= 0.0f || app_data.m_viewportSize.y <= 0.0f ||
-      g_data.total_vertex_count == 0) {
-    return;
+  // Retained layers are captured before unmapping, their vertices may have been emitted in place.
+  bool has_draw_data = write_draw_lists();
+  // The writers drop what they fail to reserve, over memory_budget or not, and log why.
+  if (has_draw_data) { write_index_data(); }
+  write_mesh_instances();
+  write_shapes();
+  write_impostors();
+  write_text();
+  for (uint32_t i = 0; i < g_data.retained_layer_count; i++) {
+    Retained_Layer& layer = g_data.retained_layers[i];
+    if (!layer.capture_pending) { continue; }
+    if (!capture_retained_layer(layer)) { release_retained_layer(layer); }
   }
+  unmap_transfer_buffers();
 
-  uint32_t new_data_buffer_size = g_data.total_vertex_count * sizeof(Im3d::VertexData);
-  if (g_data.data_buffer == nullptr || g_data.data_buffer_size < new_data_buffer_size) {
-    SDL_WaitForGPUIdle(g_data.init_info.device);
-    SDL_ReleaseGPUBuffer(g_data.init_info.device, g_data.data_buffer);
-    SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.transfer_buffer);
-    {
-      SDL_GPUBufferCreateInfo info = {};
-      info.size                    = new_data_buffer_size;
-      info.usage                   = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
-      g_data.data_buffer           = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
-      if (g_data.data_buffer == nullptr) {
-        SDL_LogError(
-            SDL_LOG_CATEGORY_APPLICATION,
-            "Failed to create data buffer: %s",
-            SDL_GetError());
-        SDL_assert(false);
-        return;
-      }
-    }
-    {
-      SDL_GPUTransferBufferCreateInfo info = {};
-      info.size                            = new_data_buffer_size;
-      info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-      g_data.transfer_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
-      if (g_data.transfer_buffer == nullptr) {
-        SDL_LogError(
-            SDL_LOG_CATEGORY_APPLICATION,
-            "Failed to create transfer buffer: %s",
-            SDL_GetError());
-        SDL_assert(false);
-        return;
-      }
+  // A resident buffer reserved this frame must still receive the live draw lists.
+  if (!has_draw_data) {
+    g_data.total_vertex_count = 0;
+    g_data.upload_range_count = 0;
+    if (g_data.retired_resident_buffer == nullptr && g_data.retained_layer_count == 0 &&
+        !has_mesh_uploads() && g_data.shape_ring.size == 0 && g_data.impostor_ring.size == 0 &&
+        g_data.text_ring.size == 0 && g_data.font_upload_buffer == nullptr) {
+      return;
     }
-    g_data.data_buffer_size = new_data_buffer_size;
   }
 
-  {
-    auto vertex_data_dst = static_cast<Im3d::VertexData*>(
-        SDL_MapGPUTransferBuffer(g_data.init_info.device, g_data.transfer_buffer, true));
-    if (vertex_data_dst == nullptr) {
-      SDL_LogError(
-          SDL_LOG_CATEGORY_APPLICATION,
-          "Failed to map transfer buffer: %s",
-          SDL_GetError());
-      SDL_assert(false);
-      return;
-    }
-    for (uint32_t i = 0; i < Im3d::GetDrawListCount(); i++) {
-      const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
-      SDL_memcpy(
-          vertex_data_dst,
-          draw_list.m_vertexData,
-          draw_list.m_vertexCount * sizeof(Im3d::VertexData));
-      vertex_data_dst += draw_list.m_vertexCount;
-    }
-    SDL_UnmapGPUTransferBuffer(g_data.init_info.device, g_data.transfer_buffer);
+  uint32_t region_offset = g_data.data_region_index * g_data.data_region_size;
+
+  // The region written this frame is not referenced by any in-flight frame, so neither the
+  // transfer buffer nor the data buffer needs to be cycled.
+  SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
+  update_resident_buffer(copy_pass);
+  for (uint32_t i = 0; i < g_data.retained_layer_count; i++) {
+    Retained_Layer& layer = g_data.retained_layers[i];
+    if (layer.upload_buffer == nullptr) { continue; }
+
+    SDL_GPUTransferBufferLocation location = {};
+    location.transfer_buffer               = layer.upload_buffer;
+
+    SDL_GPUBufferRegion buffer_region = {};
+    buffer_region.buffer              = layer.buffer;
+    buffer_region.size                = layer.buffer_size;
+
+    SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+    release_retained_upload_buffer(layer);
   }
+  for (uint32_t i = 0; i < g_data.upload_range_count; i++) {
+    const Upload_Range& range = g_data.upload_ranges[i];
 
-  {
     SDL_GPUTransferBufferLocation location = {};
     location.transfer_buffer               = g_data.transfer_buffer;
+    location.offset                        = region_offset + range.offset;
 
     SDL_GPUBufferRegion buffer_region = {};
     buffer_region.buffer              = g_data.data_buffer;
-    buffer_region.size                = new_data_buffer_size;
+    buffer_region.offset              = region_offset + range.offset;
+    buffer_region.size                = range.size;
+
+    SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+  }
+  upload_ring(copy_pass, g_data.index_ring);
+  upload_ring(copy_pass, g_data.mesh_instance_ring);
+  upload_ring(copy_pass, g_data.shape_ring);
+  upload_ring(copy_pass, g_data.impostor_ring);
+  upload_ring(copy_pass, g_data.text_ring);
+  if (g_data.vertex_upload_buffer != nullptr) {
+    SDL_GPUTransferBufferLocation location = {};
+    location.transfer_buffer               = g_data.vertex_upload_buffer;
+
+    SDL_GPUBufferRegion buffer_region = {};
+    buffer_region.buffer              = g_data.vertex_buffer;
+    buffer_region.size                = 4 * sizeof(Im3d::Vec4);
+
+    SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+    SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.vertex_upload_buffer);
+    g_data.vertex_upload_buffer = nullptr;
+  }
+  for (uint32_t i = 0; i < g_data.mesh_count; i++) {
+    Mesh& mesh = g_data.meshes[i];
+    if (mesh.upload_buffer == nullptr) { continue; }
+
+    SDL_GPUTransferBufferLocation location = {};
+    location.transfer_buffer               = mesh.upload_buffer;
+
+    SDL_GPUBufferRegion buffer_region = {};
+    buffer_region.buffer              = mesh.buffer;
+    buffer_region.size                = mesh.vertex_count * sizeof(Im3d::Vec4);
+
+    SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+    SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, mesh.upload_buffer);
+    mesh.upload_buffer = nullptr;
+  }
+  if (g_data.font_upload_buffer != nullptr) {
+    SDL_GPUTransferBufferLocation location = {};
+    location.transfer_buffer               = g_data.font_upload_buffer;
+
+    SDL_GPUBufferRegion buffer_region = {};
+    buffer_region.buffer              = g_data.font_glyph_buffer;
+    buffer_region.size                = g_data.font_glyph_count * sizeof(Glyph_Record);
+
+    SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+    SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, g_data.font_upload_buffer);
+    g_data.font_upload_buffer = nullptr;
+  }
+
+  // Batches are written last, update_resident_buffer assigns the final resident offsets.
+  if (write_draw_batches()) {
+    uint32_t draw_region_offset = g_data.data_region_index * draw_region_size(g_data.draw_capacity);
+    uint32_t command_offset     = g_data.draw_capacity * sizeof(Draw_Segment);
+
+    SDL_GPUTransferBufferLocation location = {};
+    location.transfer_buffer               = g_data.draw_transfer_buffer;
+    location.offset                        = draw_region_offset;
+
+    SDL_GPUBufferRegion buffer_region = {};
+    buffer_region.buffer              = g_data.draw_buffer;
+    buffer_region.offset              = draw_region_offset;
+    buffer_region.size                = g_data.draw_segment_count * sizeof(Draw_Segment);
+    SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+
+    // The cull pass counts the visible instances of culled batches into the cull buffer's copy.
+    location.offset      = draw_region_offset + command_offset;
+    buffer_region.offset = draw_region_offset + command_offset;
+    buffer_region.size   = g_data.draw_batch_count * sizeof(SDL_GPUIndirectDrawCommand);
+    if (g_data.cull_commands) {
+      buffer_region.buffer = g_data.cull_buffer;
+      buffer_region.offset = g_data.data_region_index * cull_region_size();
+    }
+    SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, false);
+  }
+  SDL_EndGPUCopyPass(copy_pass);
+
+  if (g_data.draw_batch_count > 0 && g_data.cull_instance_count > 0) {
+    cull_draw_batches(command_buffer);
+  }
+  if (g_data.draw_batch_count > 0 && g_data.sort_instance_count > 0) {
+    sort_draw_batches(command_buffer);
+  }
+  if (g_data.init_info.overlay_scale > 0.0f) { render_overlay(command_buffer); }
+}
+
+void im3d_sdl3_gpu_set_layer_generation(Im3d::Id layer_id, uint64_t generation) {
+  Layer_Info* layer_info = get_layer_info(layer_id);
+  if (layer_info == nullptr) { return; }
+  layer_info->has_generation = true;
+  layer_info->generation     = generation;
+}
+
+void im3d_sdl3_gpu_set_layer_reorderable(Im3d::Id layer_id, bool reorderable) {
+  Layer_Info* layer_info = get_layer_info(layer_id);
+  if (layer_info == nullptr) { return; }
+  layer_info->has_reorderable = true;
+  layer_info->reorderable     = reorderable;
+}
+
+void im3d_sdl3_gpu_set_layer_depth_mode(Im3d::Id layer_id, Im3d_SDL3_GPU_Depth_Mode depth_mode) {
+  Layer_Info* layer_info = get_layer_info(layer_id);
+  if (layer_info == nullptr) { return; }
+  layer_info->depth_mode = depth_mode;
+}
 
-    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(command_buffer);
-    SDL_UploadToGPUBuffer(copy_pass, &location, &buffer_region, true);
-    SDL_EndGPUCopyPass(copy_pass);
+void im3d_sdl3_gpu_retain_layer(Im3d::Id layer_id) {
+  Retained_Layer* layer = find_retained_layer(layer_id);
+  if (layer == nullptr) {
+    auto retained_layers = static_cast<Retained_Layer*>(SDL_realloc(
+        g_data.retained_layers,
+        (g_data.retained_layer_count + 1) * sizeof(Retained_Layer)));
+    if (retained_layers == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate retained layers");
+      return;
+    }
+    g_data.retained_layers = retained_layers;
+    layer                  = &g_data.retained_layers[g_data.retained_layer_count++];
+    *layer                 = {};
+    layer->layer_id        = layer_id;
   }
+  layer->capture_pending = true;
+}
+
+void im3d_sdl3_gpu_invalidate_layer(Im3d::Id layer_id) {
+  Retained_Layer* layer = find_retained_layer(layer_id);
+  if (layer == nullptr) { return; }
+
+  release_retained_layer(*layer);
+  *layer = g_data.retained_layers[--g_data.retained_layer_count];
 }
 
 void im3d_sdl3_gpu_render_draw_data(
     SDL_GPUCommandBuffer* command_buffer,
     SDL_GPURenderPass*    render_pass) {
+  Im3d_SDL3_GPU_Render_Target target = {};
+  target.color_format                = g_data.init_info.color_target_format;
+  target.sample_count                = g_data.init_info.msaa_samples;
+  target.depth_stencil_format        = g_data.init_info.depth_stencil_format;
+  target.blend_mode                  = IM3D_SDL3_GPU_BLEND_MODE_ALPHA;
+  im3d_sdl3_gpu_render_draw_data(command_buffer, render_pass, target);
+}
+
+void im3d_sdl3_gpu_render_draw_data(
+    SDL_GPUCommandBuffer*              command_buffer,
+    SDL_GPURenderPass*                 render_pass,
+    const Im3d_SDL3_GPU_Render_Target& target) {
   SDL_assert(g_data.init_info.device != nullptr);
   SDL_assert(command_buffer != nullptr);
   SDL_assert(render_pass != nullptr);
@@ -539,63 +4389,339 @@ void im3d_sdl3_gpu_render_draw_data(
   const Im3d::AppData& app_data = Im3d::GetAppData();
   if (app_data.m_viewportSize.x <= 0.0f || app_data.m_viewportSize.y <= 0.0f) { return; }
 
-  {
-    SDL_GPUBufferBinding binding = {};
-    binding.buffer               = g_data.vertex_buffer;
-    SDL_BindGPUVertexBuffers(render_pass, 0, &binding, 1);
+  // Without overlay target the draw lists are drawn straight into the render pass.
+  bool overlay   = g_data.overlay_draw_size.x > 0.0f;
+  bool has_lists = overlay || has_draws();
+  if (!has_lists && g_data.text_draw_count == 0) { return; }
+
+  Target_Pipelines* target_pipelines = find_target_pipelines(target);
+  if (target_pipelines == nullptr) {
+    SDL_assert(false);
+    return;
+  }
+  if (overlay && has_lists) {
+    composite_overlay(command_buffer, render_pass, *target_pipelines);
+  } else if (has_lists) {
+    render_draw_lists(command_buffer, render_pass, *target_pipelines, app_data.m_viewportSize);
   }
+  if (g_data.text_draw_count > 0) { render_text(command_buffer, render_pass, *target_pipelines); }
+}
 
-  if (g_data.total_vertex_count > 0) {
-    SDL_BindGPUVertexStorageBuffers(render_pass, 0, &g_data.data_buffer, 1);
+Im3d_SDL3_GPU_Mesh im3d_sdl3_gpu_create_mesh(
+    Im3d_SDL3_GPU_Mesh_Type type,
+    const Im3d::Vec4*       vertices,
+    uint32_t                vertex_count) {
+  SDL_assert(g_data.init_info.device != nullptr);
+
+  uint32_t primitive_count = type == IM3D_SDL3_GPU_MESH_TYPE_LINES ? 2 : 3;
+  if (vertex_count == 0 || vertex_count % primitive_count != 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Mesh vertex count must be whole primitives");
+    return 0;
   }
 
-  Vertex_Uniforms uniforms         = {};
-  uniforms.world_to_clip_transform = g_data.world_to_clip_transform;
-  uniforms.resolution              = app_data.m_viewportSize;
+  uint32_t mesh_index = 0;
+  while (mesh_index < g_data.mesh_count && g_data.meshes[mesh_index].buffer != nullptr) {
+    mesh_index++;
+  }
+  if (mesh_index == g_data.mesh_count) {
+    auto meshes =
+        static_cast<Mesh*>(SDL_realloc(g_data.meshes, (g_data.mesh_count + 1) * sizeof(Mesh)));
+    if (meshes == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate meshes");
+      return 0;
+    }
+    g_data.meshes                      = meshes;
+    g_data.meshes[g_data.mesh_count++] = {};
+  }
 
+  Mesh&    mesh        = g_data.meshes[mesh_index];
+  uint32_t buffer_size = vertex_count * sizeof(Im3d::Vec4);
+  if (!within_memory_budget(buffer_size, "mesh")) { return 0; }
   {
-    SDL_GPUViewport viewport = {};
-    viewport.w               = app_data.m_viewportSize.x;
-    viewport.h               = app_data.m_viewportSize.y;
-    viewport.min_depth       = 0.0f;
-    viewport.max_depth       = 1.0f;
-    SDL_SetGPUViewport(render_pass, &viewport);
+    SDL_GPUBufferCreateInfo info = {};
+    info.size                    = buffer_size;
+    info.usage                   = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
+    mesh.buffer                  = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+    if (mesh.buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create mesh buffer: %s",
+          SDL_GetError());
+      return 0;
+    }
+  }
+  mesh.type         = type;
+  mesh.vertex_count = vertex_count;
+  track_memory(buffer_size);
+  {
+    SDL_GPUTransferBufferCreateInfo info = {};
+    info.size                            = buffer_size;
+    info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    mesh.upload_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
+    if (mesh.upload_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create transfer buffer: %s",
+          SDL_GetError());
+      release_mesh(mesh);
+      return 0;
+    }
   }
 
-  uint32_t instance_offset = 0;
-  for (uint32_t i = 0; i < Im3d::GetDrawListCount(); i++) {
-    const Im3d::DrawList& draw_list = Im3d::GetDrawLists()[i];
+  void* mapped_data = SDL_MapGPUTransferBuffer(g_data.init_info.device, mesh.upload_buffer, false);
+  if (mapped_data == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to map transfer buffer: %s",
+        SDL_GetError());
+    release_mesh(mesh);
+    return 0;
+  }
+  SDL_memcpy(mapped_data, vertices, buffer_size);
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, mesh.upload_buffer);
 
-    SDL_GPUGraphicsPipeline* prim_pipeline;
-    uint32_t                 num_vertices;
-    uint32_t                 num_instances;
-    switch (draw_list.m_primType) {
-    case Im3d::DrawPrimitive_Points:
-      prim_pipeline = g_data.pipeline_points;
-      num_vertices  = 4;
-      num_instances = draw_list.m_vertexCount;
-      break;
-    case Im3d::DrawPrimitive_Lines:
-      prim_pipeline = g_data.pipeline_lines;
-      num_vertices  = 4;
-      num_instances = draw_list.m_vertexCount / 2;
-      break;
-    case Im3d::DrawPrimitive_Triangles:
-      prim_pipeline = g_data.pipeline_triangles;
-      num_vertices  = 3;
-      num_instances = draw_list.m_vertexCount / 3;
-      break;
-    default:
-      SDL_assert(false);
+  return mesh_index + 1;
+}
+
+void im3d_sdl3_gpu_release_mesh(Im3d_SDL3_GPU_Mesh mesh_id) {
+  Mesh* mesh = find_mesh(mesh_id);
+  if (mesh == nullptr) { return; }
+  release_mesh(*mesh);
+}
+
+void im3d_sdl3_gpu_draw_mesh_instances(
+    Im3d_SDL3_GPU_Mesh                 mesh_id,
+    const Im3d_SDL3_GPU_Mesh_Instance* instances,
+    uint32_t                           instance_count) {
+  Mesh* mesh = find_mesh(mesh_id);
+  if (mesh == nullptr || instance_count == 0) { return; }
+
+  if (mesh->instance_count + instance_count > mesh->instance_capacity) {
+    uint32_t capacity = SDL_max(mesh->instance_capacity, MIN_DRAW_CAPACITY);
+    while (capacity < mesh->instance_count + instance_count) { capacity *= 2; }
+
+    auto mesh_instances = static_cast<Im3d_SDL3_GPU_Mesh_Instance*>(
+        SDL_realloc(mesh->instances, capacity * sizeof(Im3d_SDL3_GPU_Mesh_Instance)));
+    if (mesh_instances == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate mesh instances");
       return;
     }
+    mesh->instances         = mesh_instances;
+    mesh->instance_capacity = capacity;
+  }
+  if (push_depth_run(mesh->runs, mesh->instance_count, instance_count) == nullptr) { return; }
+  SDL_memcpy(
+      mesh->instances + mesh->instance_count,
+      instances,
+      instance_count * sizeof(Im3d_SDL3_GPU_Mesh_Instance));
+  mesh->instance_count += instance_count;
+}
 
-    uniforms.instance_offset = instance_offset;
-    SDL_PushGPUVertexUniformData(command_buffer, 0, &uniforms, sizeof(uniforms));
+Im3d_SDL3_GPU_Mesh_Instance im3d_sdl3_gpu_mesh_instance(
+    const Im3d::Mat4& transform,
+    Im3d::Color       color,
+    float             size) {
+  Im3d_SDL3_GPU_Mesh_Instance instance = {};
+  for (int row = 0; row < 3; row++) {
+    instance.transform[row] = Im3d::Vec4(
+        transform(row, 0),
+        transform(row, 1),
+        transform(row, 2),
+        transform(row, 3));
+  }
+  instance.color = color;
+  instance.size  = size;
+  return instance;
+}
+
+void im3d_sdl3_gpu_draw_shapes(const Im3d_SDL3_GPU_Shape* shapes, uint32_t shape_count) {
+  if (g_data.shape_count + shape_count > g_data.shape_capacity) {
+    uint32_t capacity = SDL_max(g_data.shape_capacity, MIN_DRAW_CAPACITY);
+    while (capacity < g_data.shape_count + shape_count) { capacity *= 2; }
+
+    auto shape_records =
+        static_cast<Shape_Record*>(SDL_realloc(g_data.shapes, capacity * sizeof(Shape_Record)));
+    if (shape_records == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate shapes");
+      return;
+    }
+    g_data.shapes         = shape_records;
+    g_data.shape_capacity = capacity;
+  }
+
+  for (uint32_t i = 0; i < shape_count; i++) {
+    const Im3d_SDL3_GPU_Shape& shape = shapes[i];
+    if (shape.type > IM3D_SDL3_GPU_SHAPE_CONE) { continue; }
+
+    Depth_Run* run = push_depth_run(g_data.shape_runs, g_data.shape_count, 1);
+    if (run == nullptr) { return; }
+
+    // The detail is even, capsule profiles switch ends half way around.
+    Shape_Record& record = g_data.shapes[g_data.shape_count++];
+    record               = {};
+    record.first_line    = run->line_count;
+    record.type          = shape.type;
+    record.adaptive      = shape.detail == 0;
+    record.detail        = shape.detail == 0 ? MAX_SHAPE_DETAIL : shape.detail;
+    record.detail        = SDL_clamp(record.detail, MIN_SHAPE_DETAIL, MAX_SHAPE_DETAIL);
+    record.detail       += record.detail % 2;
+    record.position      = shape.position;
+    record.radius        = shape.radius;
+    record.direction     = shape.direction;
+    record.size          = shape.size;
+    record.color         = shape.color;
+
+    run->line_count += shape_line_count(record.type, record.detail);
+  }
+}
+
+void im3d_sdl3_gpu_draw_filled_shapes(const Im3d_SDL3_GPU_Shape* shapes, uint32_t shape_count) {
+  if (g_data.impostor_count + shape_count > g_data.impostor_capacity) {
+    uint32_t capacity = SDL_max(g_data.impostor_capacity, MIN_DRAW_CAPACITY);
+    while (capacity < g_data.impostor_count + shape_count) { capacity *= 2; }
+
+    auto impostor_records =
+        static_cast<Shape_Record*>(SDL_realloc(g_data.impostors, capacity * sizeof(Shape_Record)));
+    if (impostor_records == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate filled shapes");
+      return;
+    }
+    g_data.impostors         = impostor_records;
+    g_data.impostor_capacity = capacity;
+  }
+
+  // Only spheres and capsules have an impostor.
+  for (uint32_t i = 0; i < shape_count; i++) {
+    const Im3d_SDL3_GPU_Shape& shape = shapes[i];
+    if (shape.type != IM3D_SDL3_GPU_SHAPE_SPHERE && shape.type != IM3D_SDL3_GPU_SHAPE_CAPSULE) {
+      continue;
+    }
+
+    if (push_depth_run(g_data.impostor_runs, g_data.impostor_count, 1) == nullptr) { return; }
+    Shape_Record& record = g_data.impostors[g_data.impostor_count++];
+    record               = {};
+    record.type          = shape.type;
+    record.position      = shape.position;
+    record.radius        = shape.radius;
+    record.direction     = shape.direction;
+    record.color         = shape.color;
+  }
+}
+
+Im3d_SDL3_GPU_Memory_Stats im3d_sdl3_gpu_get_memory_stats() {
+  return g_data.memory_stats;
+}
+
+float im3d_sdl3_gpu_get_overlay_scale() {
+  return g_data.overlay_scale;
+}
+
+bool im3d_sdl3_gpu_set_font(const Im3d_SDL3_GPU_Font& font) {
+  SDL_assert(g_data.init_info.device != nullptr);
+
+  if (font.atlas == nullptr || font.glyphs == nullptr || font.glyph_count == 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Font must have an atlas and glyphs");
+    return false;
+  }
+
+  if (g_data.text_runs == nullptr) {
+    uint32_t cache_size = g_data.init_info.text_cache_size > 0 ? g_data.init_info.text_cache_size
+                                                               : DEFAULT_TEXT_CACHE_SIZE;
+    uint32_t set_count  = 1;
+    while (set_count * TEXT_RUN_WAYS < cache_size) { set_count *= 2; }
+
+    g_data.text_runs =
+        static_cast<Text_Run*>(SDL_calloc(set_count * TEXT_RUN_WAYS, sizeof(Text_Run)));
+    if (g_data.text_runs == nullptr) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate text runs");
+      return false;
+    }
+    g_data.text_run_set_count = set_count;
+  }
+
+  uint32_t buffer_size = font.glyph_count * sizeof(Glyph_Record);
+  if (!within_memory_budget(
+          int64_t(buffer_size) - int64_t(g_data.font_glyph_count * sizeof(Glyph_Record)),
+          "glyph")) {
+    return false;
+  }
+
+  uint32_t glyph_size = font.glyph_count * sizeof(Im3d_SDL3_GPU_Glyph);
+  auto     glyphs     = static_cast<Im3d_SDL3_GPU_Glyph*>(SDL_malloc(glyph_size));
+  if (glyphs == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate font glyphs");
+    return false;
+  }
+  SDL_memcpy(glyphs, font.glyphs, glyph_size);
+  SDL_qsort(glyphs, font.glyph_count, sizeof(Im3d_SDL3_GPU_Glyph), compare_glyphs);
+
+  SDL_GPUBuffer* glyph_buffer;
+  {
+    SDL_GPUBufferCreateInfo info = {};
+    info.size                    = buffer_size;
+    info.usage                   = SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
+    glyph_buffer                 = SDL_CreateGPUBuffer(g_data.init_info.device, &info);
+    if (glyph_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create glyph buffer: %s",
+          SDL_GetError());
+      SDL_free(glyphs);
+      return false;
+    }
+  }
+  SDL_GPUTransferBuffer* upload_buffer;
+  {
+    SDL_GPUTransferBufferCreateInfo info = {};
+    info.size                            = buffer_size;
+    info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    upload_buffer = SDL_CreateGPUTransferBuffer(g_data.init_info.device, &info);
+    if (upload_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create transfer buffer: %s",
+          SDL_GetError());
+      SDL_ReleaseGPUBuffer(g_data.init_info.device, glyph_buffer);
+      SDL_free(glyphs);
+      return false;
+    }
+  }
+
+  auto records = static_cast<Glyph_Record*>(
+      SDL_MapGPUTransferBuffer(g_data.init_info.device, upload_buffer, false));
+  if (records == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to map transfer buffer: %s",
+        SDL_GetError());
+    SDL_ReleaseGPUTransferBuffer(g_data.init_info.device, upload_buffer);
+    SDL_ReleaseGPUBuffer(g_data.init_info.device, glyph_buffer);
+    SDL_free(glyphs);
+    return false;
+  }
+  for (uint32_t i = 0; i < font.glyph_count; i++) {
+    records[i] = {glyphs[i].plane_rect, glyphs[i].uv_rect};
+  }
+  SDL_UnmapGPUTransferBuffer(g_data.init_info.device, upload_buffer);
 
-    SDL_BindGPUGraphicsPipeline(render_pass, prim_pipeline);
-    SDL_DrawGPUPrimitives(render_pass, num_vertices, num_instances, 0, 0);
+  // Frames in flight keep the released glyph buffer alive until they complete. Runs laid out with
+  // the old glyph metrics are emptied.
+  release_font();
+  track_memory(buffer_size);
 
-    instance_offset += draw_list.m_vertexCount;
+  g_data.font_type          = font.type;
+  g_data.font_atlas         = font.atlas;
+  g_data.font_line_height   = font.line_height;
+  g_data.font_glyphs        = glyphs;
+  g_data.font_glyph_count   = font.glyph_count;
+  g_data.font_glyph_buffer  = glyph_buffer;
+  g_data.font_upload_buffer = upload_buffer;
+
+  // ASCII skips the binary search, it's most of the text of debug labels.
+  g_data.font_fallback_glyph = search_glyph('?');
+  for (uint32_t i = 0; i < SDL_arraysize(g_data.font_ascii_glyphs); i++) {
+    const Im3d_SDL3_GPU_Glyph* glyph = search_glyph(i);
+    g_data.font_ascii_glyphs[i]      = glyph != nullptr ? glyph : g_data.font_fallback_glyph;
   }
+  return true;
 }
@@ -3,10 +3,125 @@
 #include "im3d.h"
 #include <SDL3/SDL.h>
 
+enum Im3d_SDL3_GPU_Vertex_Format {
+  IM3D_SDL3_GPU_VERTEX_FORMAT_FULL,    // Im3d::VertexData as is, 32 bytes per vertex.
+  IM3D_SDL3_GPU_VERTEX_FORMAT_PACKED,  // Position quantized to the draw list bounds, 16 bytes.
+};
+
+// Depth test and write of a layer's draw lists, see im3d_sdl3_gpu_set_layer_depth_mode. Only used
+// with a depth_stencil_format, fragments pass when they are nearer than or as near as the depth.
+enum Im3d_SDL3_GPU_Depth_Mode {
+  IM3D_SDL3_GPU_DEPTH_MODE_DEFAULT,     // TEST_WRITE for unsorted triangles, TEST for sorted
+                                        // triangles, lines and points, OFF for text.
+  IM3D_SDL3_GPU_DEPTH_MODE_OFF,         // Drawn over everything, like without a depth target.
+  IM3D_SDL3_GPU_DEPTH_MODE_TEST,        // Hidden by nearer geometry, hides nothing.
+  IM3D_SDL3_GPU_DEPTH_MODE_TEST_WRITE,  // Hidden by nearer geometry, hides farther geometry.
+};
+
+// How Im3d's colors are blended into a color target, see Im3d_SDL3_GPU_Render_Target.
+enum Im3d_SDL3_GPU_Blend_Mode {
+  IM3D_SDL3_GPU_BLEND_MODE_ALPHA,          // Over the target's colors.
+  IM3D_SDL3_GPU_BLEND_MODE_PREMULTIPLIED,  // Alpha accumulates coverage, for targets composited
+                                           // later with premultiplied alpha.
+  IM3D_SDL3_GPU_BLEND_MODE_ADDITIVE,       // Added to the target's colors, its alpha is kept.
+};
+
+// A render pass configuration im3d_sdl3_gpu_render_draw_data draws into. The pipelines of each
+// distinct configuration are created the first time it is drawn into.
+struct Im3d_SDL3_GPU_Render_Target {
+  SDL_GPUTextureFormat     color_format;
+  SDL_GPUSampleCount       sample_count;          // 1 = antialiased edges of opaque triangles.
+  SDL_GPUTextureFormat     depth_stencil_format;  // INVALID = no depth.
+  Im3d_SDL3_GPU_Blend_Mode blend_mode;
+};
+
+// color_target_format, msaa_samples and depth_stencil_format describe the render pass of
+// im3d_sdl3_gpu_render_draw_data without a target, drawn into with IM3D_SDL3_GPU_BLEND_MODE_ALPHA.
 struct Im3d_SDL3_GPU_Init_Info {
-  SDL_GPUDevice*       device;
-  SDL_GPUTextureFormat color_target_format;
-  SDL_GPUSampleCount   msaa_samples;
+  SDL_GPUDevice*              device;
+  SDL_GPUTextureFormat        color_target_format;
+  SDL_GPUSampleCount          msaa_samples;          // 1 = antialiased edges of opaque triangles.
+  SDL_GPUTextureFormat        depth_stencil_format;  // Of the render pass, INVALID = no depth.
+  uint32_t                    frames_in_flight;      // SDL_SetGPUAllowedFramesInFlight, 0 = 2.
+  float                       buffer_growth_factor;  // Upload ring growth and headroom, 0 = 1.5.
+  uint32_t                    buffer_shrink_frames;  // Quiet frames before trimming, 0 = never.
+  uint64_t                    memory_budget;         // Backend GPU memory limit, what doesn't fit
+                                                     // is dropped or degraded, 0 = unlimited.
+  Im3d_SDL3_GPU_Vertex_Format vertex_format;
+  bool                        zero_copy_emission;    // Unsorted vertices written straight to the
+                                                     // upload buffer, FULL vertex format only.
+  uint32_t                    copy_thread_count;     // Upload copy workers besides the caller.
+  bool                        cache_draw_lists;      // Keep unchanged draw lists on the GPU.
+  bool                        reorder_draw_lists;    // Batch unsorted lists across layers by
+                                                     // primitive type, see set_layer_reorderable.
+  bool                        gpu_culling;           // Frustum cull large batches per primitive
+                                                     // in a compute pass before drawing them.
+  bool                        gpu_sorting;           // Depth sort Im3d's sorted primitives with a
+                                                     // compute radix sort instead of on the CPU.
+                                                     // Only orders primitives within each batch
+                                                     // of one layer and primitive type, where the
+                                                     // CPU sort orders them across types, a
+                                                     // warning is logged when types are mixed.
+  float                       overlay_scale;         // Draws into an offscreen target this scale
+                                                     // of the viewport, see render_draw_data.
+                                                     // Requires no depth_stencil_format.
+  float                       overlay_min_scale;     // Lowest dynamic overlay scale, 0 = 0.5.
+  float                       overlay_frame_budget;  // Seconds, the overlay scale follows the
+                                                     // frame delta_time, 0 = fixed scale. With
+                                                     // VSYNC delta_time never drops below the
+                                                     // refresh interval, so the budget must be
+                                                     // longer than that.
+  uint32_t                    text_cache_size;       // Laid out Im3d::Text strings kept across
+                                                     // frames, 0 = 4096.
+};
+
+struct Im3d_SDL3_GPU_Memory_Stats {
+  uint64_t current_bytes;
+  uint64_t peak_bytes;
+  uint32_t dropped_vertex_count;  // Vertices not drawn last frame because of memory_budget.
+};
+
+enum Im3d_SDL3_GPU_Mesh_Type {
+  IM3D_SDL3_GPU_MESH_TYPE_LINES,      // Pairs of vertices, like Im3d::BeginLines.
+  IM3D_SDL3_GPU_MESH_TYPE_TRIANGLES,  // Triples of vertices, like Im3d::BeginTriangles.
+};
+
+// A mesh of im3d_sdl3_gpu_create_mesh, 0 is never a valid mesh.
+typedef uint32_t Im3d_SDL3_GPU_Mesh;
+
+// Unit shapes created by im3d_sdl3_gpu_init.
+enum Im3d_SDL3_GPU_Builtin_Mesh : Im3d_SDL3_GPU_Mesh {
+  IM3D_SDL3_GPU_MESH_SPHERE = 1,     // Radius 1, like Im3d::DrawSphere.
+  IM3D_SDL3_GPU_MESH_BOX,            // From -1 to 1, like Im3d::DrawAlignedBox.
+  IM3D_SDL3_GPU_MESH_ARROW,          // From the origin to (0, 0, 1), like Im3d::DrawArrow.
+  IM3D_SDL3_GPU_MESH_SPHERE_FILLED,  // Radius 1, like Im3d::DrawSphereFilled.
+  IM3D_SDL3_GPU_MESH_BOX_FILLED,     // From -1 to 1, like Im3d::DrawAlignedBoxFilled.
+};
+
+// Per instance record of im3d_sdl3_gpu_draw_mesh_instances, see im3d_sdl3_gpu_mesh_instance.
+struct Im3d_SDL3_GPU_Mesh_Instance {
+  Im3d::Vec4  transform[3];  // The top three rows of the mesh to world transform.
+  Im3d::Color color;
+  float       size;  // Line thickness in pixels, scaled by the w of the mesh vertices.
+  uint32_t    padding[2];
+};
+
+enum Im3d_SDL3_GPU_Shape_Type {
+  IM3D_SDL3_GPU_SHAPE_CIRCLE,   // Around position, facing direction.
+  IM3D_SDL3_GPU_SHAPE_SPHERE,   // Around position, like Im3d::DrawSphere.
+  IM3D_SDL3_GPU_SHAPE_CAPSULE,  // From position to position + direction, like Im3d::DrawCapsule.
+  IM3D_SDL3_GPU_SHAPE_CONE,     // Base at position, apex at position + direction.
+};
+
+// A shape of im3d_sdl3_gpu_draw_shapes or im3d_sdl3_gpu_draw_filled_shapes, in world space.
+struct Im3d_SDL3_GPU_Shape {
+  Im3d_SDL3_GPU_Shape_Type type;
+  Im3d::Vec3               position;
+  Im3d::Vec3               direction;
+  float                    radius;
+  Im3d::Color              color;
+  float                    size;    // Line thickness in pixels.
+  uint32_t                 detail;  // Lines per ring, 0 picks them from the size on screen.
 };
 
 struct Im3d_SDL3_GPU_Frame_Info {
@@ -20,10 +135,112 @@ struct Im3d_SDL3_GPU_Frame_Info {
   float      fov_rad;
 };
 
+// Doesn't wait for the GPU. Pipelines are created the first time they are drawn with, failures are
+// logged then and their draws skipped.
 bool im3d_sdl3_gpu_init(const Im3d_SDL3_GPU_Init_Info& info);
 void im3d_sdl3_gpu_shutdown();
 void im3d_sdl3_gpu_new_frame(const Im3d_SDL3_GPU_Frame_Info& info);
+// Records this frame's uploads. command_buffer can be a separate one submitted before acquiring the
+// swapchain texture, as long as it is submitted before the one used to render the draw data. With
+// an overlay_scale the draw data is also drawn into the overlay target here, in a render pass of
+// its own, so it must not be called inside a render pass.
 void im3d_sdl3_gpu_prepare_draw_data(SDL_GPUCommandBuffer* command_buffer);
+// Draws this frame's draw data into render_pass, or with an overlay_scale upsamples the overlay
+// target over it. The overlay has no depth, so init rejects an overlay_scale together with a
+// depth_stencil_format. Text is always drawn last, at full resolution into render_pass.
 void im3d_sdl3_gpu_render_draw_data(
     SDL_GPUCommandBuffer* command_buffer,
     SDL_GPURenderPass*    render_pass);
+// Draws this frame's draw data into a render pass of target instead, at the same viewport size. Can
+// be called for several targets in a frame, e.g. a thumbnail or an HDR buffer besides the window.
+void im3d_sdl3_gpu_render_draw_data(
+    SDL_GPUCommandBuffer*              command_buffer,
+    SDL_GPURenderPass*                 render_pass,
+    const Im3d_SDL3_GPU_Render_Target& target);
+Im3d_SDL3_GPU_Memory_Stats im3d_sdl3_gpu_get_memory_stats();
+// The scale of the viewport the overlay was last drawn at, 0 without an overlay_scale.
+float im3d_sdl3_gpu_get_overlay_scale();
+
+// With cache_draw_lists, the draw lists of layer_id count as unchanged for as long as generation
+// stays the same, instead of hashing their vertices every frame. The generation is forgotten after
+// a frame without draw lists in layer_id.
+void im3d_sdl3_gpu_set_layer_generation(Im3d::Id layer_id, uint64_t generation);
+
+// Overrides reorder_draw_lists for layer_id. The unsorted draw lists of consecutive reorderable
+// layers may be drawn in any order, which lets lists of the same primitive type share one draw.
+void im3d_sdl3_gpu_set_layer_reorderable(Im3d::Id layer_id, bool reorderable);
+
+// Sets how the draw lists of layer_id use the depth target. Opaque filled layers drawn first with
+// TEST_WRITE let the GPU reject the hidden fragments of later layers before shading them. The
+// IM3D_GIZMO_LAYER_ID layer starts out OFF.
+void im3d_sdl3_gpu_set_layer_depth_mode(Im3d::Id layer_id, Im3d_SDL3_GPU_Depth_Mode depth_mode);
+
+// Captures the draw lists of layer_id from the current frame into a GPU buffer of their own during
+// the next im3d_sdl3_gpu_prepare_draw_data, and keeps drawing them every frame until
+// im3d_sdl3_gpu_invalidate_layer. They are drawn in the layer's place among the unsorted draw lists,
+// sorted primitives included. The app can stop emitting the layer once it is retained, vertices
+// emitted for it later are ignored. Call again to recapture the layer.
+void im3d_sdl3_gpu_retain_layer(Im3d::Id layer_id);
+void im3d_sdl3_gpu_invalidate_layer(Im3d::Id layer_id);
+
+// Creates a mesh for im3d_sdl3_gpu_draw_mesh_instances, uploaded during the next
+// im3d_sdl3_gpu_prepare_draw_data. The w of each vertex scales the instance size of line meshes.
+// Returns 0 on failure.
+Im3d_SDL3_GPU_Mesh im3d_sdl3_gpu_create_mesh(
+    Im3d_SDL3_GPU_Mesh_Type type,
+    const Im3d::Vec4*       vertices,
+    uint32_t                vertex_count);
+void im3d_sdl3_gpu_release_mesh(Im3d_SDL3_GPU_Mesh mesh);
+
+// Draws mesh once per instance this frame. All the instances of a mesh are drawn with a single
+// instanced draw, before Im3d's draw lists, instead of tessellating each shape with Im3d. They use
+// the depth mode of the current Im3d layer, instances from layers of another mode are drawn apart.
+void im3d_sdl3_gpu_draw_mesh_instances(
+    Im3d_SDL3_GPU_Mesh                 mesh,
+    const Im3d_SDL3_GPU_Mesh_Instance* instances,
+    uint32_t                           instance_count);
+Im3d_SDL3_GPU_Mesh_Instance im3d_sdl3_gpu_mesh_instance(
+    const Im3d::Mat4& transform,
+    Im3d::Color       color,
+    float             size);
+
+// Draws shapes this frame, after the mesh instances. Each shape is a single record which the vertex
+// shader expands into lines, instead of tessellating it with Im3d. They use the depth mode of the
+// current Im3d layer, like the mesh instances.
+void im3d_sdl3_gpu_draw_shapes(const Im3d_SDL3_GPU_Shape* shapes, uint32_t shape_count);
+
+// Draws filled spheres and capsules this frame, before the mesh instances, other types are skipped.
+// Each shape is a single quad whose surface is ray cast per pixel, size and detail are unused. They
+// use the depth mode of the current Im3d layer, like the mesh instances.
+void im3d_sdl3_gpu_draw_filled_shapes(const Im3d_SDL3_GPU_Shape* shapes, uint32_t shape_count);
+
+enum Im3d_SDL3_GPU_Font_Type {
+  IM3D_SDL3_GPU_FONT_TYPE_SDF,   // Distance in the red channel.
+  IM3D_SDL3_GPU_FONT_TYPE_MSDF,  // Median of the rgb channels, keeps sharp corners.
+};
+
+// A glyph of an Im3d_SDL3_GPU_Font. Rects are min xy then max xy, the plane rect is in pixels of
+// text size 1, relative to the pen at the top left of the line with y down. Im3d's text size scales
+// the font like in Im3d's examples.
+struct Im3d_SDL3_GPU_Glyph {
+  uint32_t   codepoint;
+  Im3d::Vec4 uv_rect;
+  Im3d::Vec4 plane_rect;
+  float      advance;  // Pixels of text size 1.
+};
+
+// A distance field glyph atlas, e.g. generated offline with msdf-atlas-gen. Distances are 0.5 on
+// the glyph edges, the atlas texture is sampled with bilinear filtering.
+struct Im3d_SDL3_GPU_Font {
+  Im3d_SDL3_GPU_Font_Type    type;
+  SDL_GPUTexture*            atlas;
+  float                      line_height;  // Pixels of text size 1.
+  const Im3d_SDL3_GPU_Glyph* glyphs;
+  uint32_t                   glyph_count;
+};
+
+// Sets the font Im3d::Text is drawn with, text is skipped without one. The glyphs are copied and
+// uploaded during the next im3d_sdl3_gpu_prepare_draw_data, the atlas must outlive the font. Each
+// glyph is a single record which the vertex shader expands into a quad, the text of each layer is
+// drawn with one instanced draw after all the draw lists.
+bool im3d_sdl3_gpu_set_font(const Im3d_SDL3_GPU_Font& font);
@@ -1,15 +1,517 @@
 static const float ANTIALIASING = 2.0;
+// Pixels triangles are dilated by and faded over, without MSAA.
+static const float TRIANGLE_ANTIALIASING = 1.0;
 
-#if defined(VERTEX_SHADER)
+#if defined(VERTEX_SHADER) || defined(COMPUTE_SHADER)
+// Shared by the vertex and compute shaders, compute shaders read their uniforms from space2.
+#if defined(COMPUTE_SHADER)
+cbuffer Uniform_Block : register(b0, space2) {
+#else
+cbuffer Uniform_Block : register(b0, space1) {
+#endif
+  float4x4 world_to_clip_transform : packoffset(c0);
+  float2   resolution : packoffset(c4);
+  uint     segment_offset : packoffset(c4.z);
+  uint     segment_count : packoffset(c4.w);
+  uint     vertex_packed : packoffset(c5.x);
+  uint     remap_offset : packoffset(c5.y);
+  uint     remap_instances : packoffset(c5.z);
+  uint     primitive_vertex_count : packoffset(c5.w);
+  uint     instance_count : packoffset(c6.x);
+  uint     command_offset : packoffset(c6.y);
+  uint     sort_shift : packoffset(c6.z);
+  uint     sort_group_count : packoffset(c6.w);
+  float3   view_origin : packoffset(c7);
+  uint     sort_capacity : packoffset(c7.w);
+  uint     sort_source_offset : packoffset(c8.x);
+  uint     sort_destination_offset : packoffset(c8.y);
+  uint     sort_count_offset : packoffset(c8.z);
+  uint     primitive_vertex_stride : packoffset(c8.w);
+  uint     mesh_instance_offset : packoffset(c9.x);
+  uint     mesh_primitive_count : packoffset(c9.y);
+  uint     shape_offset : packoffset(c9.z);
+  uint     shape_count : packoffset(c9.w);
+  float4x4 clip_to_world_transform : packoffset(c10);
+  uint     triangle_antialiasing : packoffset(c14.x);
+  float2   overlay_texcoord_scale : packoffset(c14.y);
+  uint     text_offset : packoffset(c14.w);
+  uint     text_msdf : packoffset(c15.x);
+}
+#endif
+
+#if defined(VERTEX_SHADER) || defined(CULL_SHADER) || defined(SORT_KEYS_SHADER)
 struct Vertex_Data {
-  float4 position_size;
+  float3 position;
+  float  size;
+  uint   color;
+};
+
+struct Draw_Segment {
+  uint   first_instance;
+  uint   vertex_offset;
+  float3 position_origin;
+  float3 position_scale;
+};
+
+// Holds either Im3d::VertexData (32 bytes) or, when vertex_packed is set, 16 byte records of a
+// 21:21:22 bit position quantized to the draw list bounds, the rgba8 color and the size. Either way
+// the size is at byte 12, its sign bit marks the first vertex of a strip.
+ByteAddressBuffer Data_Buffer : register(t0, space0);
+
+// 32 byte Draw_Segment records, one per draw list of a batch.
+ByteAddressBuffer Segment_Buffer : register(t1, space0);
+
+// Finds the draw list of the batch that instance_id belongs to, the segments are sorted by their
+// first instance.
+Draw_Segment find_segment(uint instance_id) {
+  uint first = 0u;
+  uint last  = segment_count - 1u;
+  while (first < last) {
+    uint middle = (first + last + 1u) / 2u;
+    if (Segment_Buffer.Load((segment_offset + middle) * 32u) <= instance_id) {
+      first = middle;
+    } else {
+      last = middle - 1u;
+    }
+  }
+
+  uint4        data_0 = Segment_Buffer.Load4((segment_offset + first) * 32u);
+  uint4        data_1 = Segment_Buffer.Load4((segment_offset + first) * 32u + 16u);
+  Draw_Segment segment;
+  segment.first_instance  = data_0.x;
+  segment.vertex_offset   = data_0.y;
+  segment.position_origin = asfloat(uint3(data_0.zw, data_1.x));
+  segment.position_scale  = asfloat(data_1.yzw);
+  return segment;
+}
+
+Vertex_Data load_vertex_data(Draw_Segment segment, uint index) {
+  Vertex_Data vertex_data;
+  if (vertex_packed != 0u) {
+    uint4 data = Data_Buffer.Load4(index * 16u);
+    uint3 quantized_position =
+        uint3(data.x & 0x1fffffu, (data.x >> 21u) | ((data.y & 0x3ffu) << 11u), data.y >> 10u);
+    vertex_data.position =
+        segment.position_origin + float3(quantized_position) * segment.position_scale;
+    vertex_data.color    = data.z;
+    vertex_data.size     = abs(asfloat(data.w));
+  } else {
+    uint4 data           = Data_Buffer.Load4(index * 32u);
+    vertex_data.position = asfloat(data.xyz);
+    vertex_data.size     = abs(asfloat(data.w));
+    vertex_data.color    = Data_Buffer.Load(index * 32u + 16u);
+  }
+  return vertex_data;
+}
+
+// Strips have a primitive starting at each vertex, returns whether the one starting at first_vertex
+// would join the end of a strip to the start of the next one. Such primitives are not drawn.
+bool is_strip_break(uint first_vertex) {
+  if (primitive_vertex_stride == primitive_vertex_count) { return false; }
+
+  uint vertex_size = vertex_packed != 0u ? 16u : 32u;
+  for (uint i = 1u; i < primitive_vertex_count; i++) {
+    if ((Data_Buffer.Load((first_vertex + i) * vertex_size + 12u) & 0x80000000u) != 0u) {
+      return true;
+    }
+  }
+  return false;
+}
+#endif
+
+#if defined(CULL_SHADER)
+// Large batches are dispatched as rows of groups, see cull_draw_batches in im3d_sdl3_gpu.cpp.
+static const uint CULL_GROUPS_PER_ROW = 32768u;
+
+// The indirect draw commands of the batches followed by the indices of their visible instances.
+RWByteAddressBuffer Cull_Buffer : register(u0, space1);
+
+// Returns a bit per clip plane that the vertex is outside of, expanded by the screen space radius
+// of points and lines. The planes bound both the [0, 1] and the [-1, 1] depth range.
+uint outcode(Vertex_Data vertex_data) {
+  float4 position = mul(world_to_clip_transform, float4(vertex_data.position, 1.0));
+  float2 radius   = max(vertex_data.size, ANTIALIASING) / resolution * abs(position.w);
+  uint   code     = 0u;
+  code |= (position.x < -position.w - radius.x) ? 1u : 0u;
+  code |= (position.x > position.w + radius.x) ? 2u : 0u;
+  code |= (position.y < -position.w - radius.y) ? 4u : 0u;
+  code |= (position.y > position.w + radius.y) ? 8u : 0u;
+  code |= (position.z < -position.w) ? 16u : 0u;
+  code |= (position.z > position.w) ? 32u : 0u;
+  return code;
+}
+
+// Appends the instances of a batch which are not entirely outside one of the frustum planes to the
+// visible indices and counts them in the batch's draw command.
+[numthreads(64, 1, 1)]
+void main(uint3 dispatch_thread_id : SV_DispatchThreadID) {
+  uint instance_id = dispatch_thread_id.y * CULL_GROUPS_PER_ROW * 64u + dispatch_thread_id.x;
+  if (instance_id >= instance_count) { return; }
+
+  Draw_Segment segment = find_segment(instance_id);
+  uint         first_vertex =
+      segment.vertex_offset + (instance_id - segment.first_instance) * primitive_vertex_stride;
+  if (is_strip_break(first_vertex)) { return; }
+
+  uint code = 0x3fu;
+  for (uint i = 0u; i < primitive_vertex_count; i++) {
+    code &= outcode(load_vertex_data(segment, first_vertex + i));
+  }
+  if (code != 0u) { return; }
+
+  uint visible_index;
+  Cull_Buffer.InterlockedAdd(command_offset + 4u, 1u, visible_index);
+  Cull_Buffer.Store((remap_offset + visible_index) * 4u, instance_id);
+}
+#endif
+
+#if defined(SORT_KEYS_SHADER) || defined(SORT_COUNT_SHADER) || defined(SORT_SCAN_SHADER) || \
+    defined(SORT_SCATTER_SHADER)
+// An 8 bit per pass LSD radix sort of the primitives of sorted batches, see sort_draw_batches in
+// im3d_sdl3_gpu.cpp. Each batch owns a slice, padded to whole groups, of the two key and value
+// arrays and of the digit major count array, which are stored one after the other with
+// sort_capacity elements each.
+static const uint SORT_GROUP_SIZE = 256u;
+static const uint SORT_DIGIT_MASK = 0xffu;
+
+RWByteAddressBuffer Sort_Buffer : register(u0, space1);
+
+groupshared uint g_scan[SORT_GROUP_SIZE];
+
+// Returns the inclusive prefix sum of value over the threads of the group.
+uint group_prefix_sum(uint thread_index, uint value) {
+  g_scan[thread_index] = value;
+  GroupMemoryBarrierWithGroupSync();
+  for (uint offset = 1u; offset < SORT_GROUP_SIZE; offset *= 2u) {
+    uint addend = thread_index >= offset ? g_scan[thread_index - offset] : 0u;
+    GroupMemoryBarrierWithGroupSync();
+    g_scan[thread_index] += addend;
+    GroupMemoryBarrierWithGroupSync();
+  }
+  return g_scan[thread_index];
+}
+#endif
+
+#if defined(SORT_KEYS_SHADER)
+// Writes the key and instance index of each primitive of a batch. Squared distances are positive
+// so their bits order like unsigned integers, inverting them sorts the farthest primitive first.
+// The padding keys sort last.
+[numthreads(256, 1, 1)]
+void main(uint3 dispatch_thread_id : SV_DispatchThreadID) {
+  uint instance_id = dispatch_thread_id.x;
+  uint key         = 0xffffffffu;
+  if (instance_id < instance_count) {
+    Draw_Segment segment = find_segment(instance_id);
+    uint         first_vertex =
+        segment.vertex_offset + (instance_id - segment.first_instance) * primitive_vertex_stride;
+
+    float3 midpoint = float3(0.0, 0.0, 0.0);
+    for (uint i = 0u; i < primitive_vertex_count; i++) {
+      midpoint += load_vertex_data(segment, first_vertex + i).position;
+    }
+    float3 offset = midpoint / float(primitive_vertex_count) - view_origin;
+    key           = ~asuint(dot(offset, offset));
+  }
+  Sort_Buffer.Store((sort_destination_offset + instance_id) * 4u, key);
+  Sort_Buffer.Store((sort_destination_offset + sort_capacity + instance_id) * 4u, instance_id);
+}
+#endif
+
+#if defined(SORT_COUNT_SHADER)
+groupshared uint g_digit_counts[SORT_GROUP_SIZE];
+
+// Counts the digits of a group's keys.
+[numthreads(256, 1, 1)]
+void main(uint3 group_id : SV_GroupID, uint3 group_thread_id : SV_GroupThreadID) {
+  uint thread_index = group_thread_id.x;
+  uint source       = sort_source_offset + group_id.x * SORT_GROUP_SIZE + thread_index;
+
+  g_digit_counts[thread_index] = 0u;
+  GroupMemoryBarrierWithGroupSync();
+
+  uint key = Sort_Buffer.Load(source * 4u);
+  InterlockedAdd(g_digit_counts[(key >> sort_shift) & SORT_DIGIT_MASK], 1u);
+  GroupMemoryBarrierWithGroupSync();
+
+  uint digit = thread_index;
+  Sort_Buffer.Store(
+      (sort_count_offset + digit * sort_group_count + group_id.x) * 4u,
+      g_digit_counts[digit]);
+}
+#endif
+
+#if defined(SORT_SCAN_SHADER)
+// Turns the counts of the group's digit into their inclusive prefix sum over the key groups, one
+// group per digit. Each thread sums a run of at most 256 consecutive counts, and the run sums are
+// scanned across the group. The last sum is the digit's total, the scatter step offsets by those.
+[numthreads(256, 1, 1)]
+void main(uint3 group_id : SV_GroupID, uint3 group_thread_id : SV_GroupThreadID) {
+  uint thread_index = group_thread_id.x;
+  uint first_count  = sort_count_offset + group_id.x * sort_group_count;
+  uint run_length   = (sort_group_count + SORT_GROUP_SIZE - 1u) / SORT_GROUP_SIZE;
+  uint run_start    = min(thread_index * run_length, sort_group_count);
+  uint run_end      = min(run_start + run_length, sort_group_count);
+
+  uint run_count = 0u;
+  for (uint i = run_start; i < run_end; i++) {
+    run_count += Sort_Buffer.Load((first_count + i) * 4u);
+  }
+
+  uint sum = group_prefix_sum(thread_index, run_count) - run_count;
+  for (uint i = run_start; i < run_end; i++) {
+    sum += Sort_Buffer.Load((first_count + i) * 4u);
+    Sort_Buffer.Store((first_count + i) * 4u, sum);
+  }
+}
+#endif
+
+#if defined(SORT_SCATTER_SHADER)
+groupshared uint g_keys[SORT_GROUP_SIZE];
+groupshared uint g_values[SORT_GROUP_SIZE];
+groupshared uint g_digit_starts[SORT_GROUP_SIZE];
+groupshared uint g_digit_ends[SORT_GROUP_SIZE];
+groupshared uint g_digit_offsets[SORT_GROUP_SIZE];
+
+// Sorts a group's keys by digit with a stable split per bit, then moves each to the offset of its
+// digit, plus the count of that digit in the groups before, plus its rank among the group's keys
+// with the same digit.
+[numthreads(256, 1, 1)]
+void main(uint3 group_id : SV_GroupID, uint3 group_thread_id : SV_GroupThreadID) {
+  uint thread_index = group_thread_id.x;
+  uint source       = sort_source_offset + group_id.x * SORT_GROUP_SIZE + thread_index;
+  uint key          = Sort_Buffer.Load(source * 4u);
+  uint value        = Sort_Buffer.Load((source + sort_capacity) * 4u);
+
+  // The scan step leaves each digit's total in its last count.
+  uint digit_total =
+      Sort_Buffer.Load((sort_count_offset + (thread_index + 1u) * sort_group_count - 1u) * 4u);
+  g_digit_offsets[thread_index] = group_prefix_sum(thread_index, digit_total) - digit_total;
+
+  for (uint bit = 0u; bit < 8u; bit++) {
+    uint is_set     = (key >> (sort_shift + bit)) & 1u;
+    uint set_before = group_prefix_sum(thread_index, is_set) - is_set;
+    uint set_count  = g_scan[SORT_GROUP_SIZE - 1u];
+    GroupMemoryBarrierWithGroupSync();
+
+    uint index =
+        is_set != 0u ? SORT_GROUP_SIZE - set_count + set_before : thread_index - set_before;
+    g_keys[index]   = key;
+    g_values[index] = value;
+    GroupMemoryBarrierWithGroupSync();
+    key   = g_keys[thread_index];
+    value = g_values[thread_index];
+    GroupMemoryBarrierWithGroupSync();
+  }
+
+  uint digit = (key >> sort_shift) & SORT_DIGIT_MASK;
+  if (thread_index == 0u ||
+      digit != ((g_keys[thread_index - 1u] >> sort_shift) & SORT_DIGIT_MASK)) {
+    g_digit_starts[digit] = thread_index;
+  }
+  if (thread_index == SORT_GROUP_SIZE - 1u ||
+      digit != ((g_keys[thread_index + 1u] >> sort_shift) & SORT_DIGIT_MASK)) {
+    g_digit_ends[digit] = thread_index + 1u;
+  }
+  GroupMemoryBarrierWithGroupSync();
+
+  uint digit_count = g_digit_ends[digit] - g_digit_starts[digit];
+  uint groups_before_count =
+      Sort_Buffer.Load((sort_count_offset + digit * sort_group_count + group_id.x) * 4u) -
+      digit_count;
+  uint destination = sort_destination_offset + g_digit_offsets[digit] + groups_before_count +
+                     thread_index - g_digit_starts[digit];
+  Sort_Buffer.Store(destination * 4u, key);
+  Sort_Buffer.Store((destination + sort_capacity) * 4u, value);
+}
+#endif
+
+#if defined(VERTEX_SHADER)
+// Instance indices of culled batches, written by the cull shader, or of sorted batches, written by
+// the sort shaders.
+ByteAddressBuffer Instance_Buffer : register(t2, space0);
+
+float4 uint_to_rgba(uint u) {
+  float4 color = float4(0.0, 0.0, 0.0, 0.0);
+  color.r      = float((u & 0xff000000u) >> 24u) / 255.0;
+  color.g      = float((u & 0x00ff0000u) >> 16u) / 255.0;
+  color.b      = float((u & 0x0000ff00u) >> 8u) / 255.0;
+  color.a      = float((u & 0x000000ffu) >> 0u) / 255.0;
+  return color;
+}
+
+#if defined(PARAMETRIC_SHAPES) || defined(SHAPE_IMPOSTORS)
+static const float TWO_PI = 6.28318530718;
+
+static const uint SHAPE_CIRCLE  = 0u;
+static const uint SHAPE_SPHERE  = 1u;
+static const uint SHAPE_CAPSULE = 2u;
+static const uint SHAPE_CONE    = 3u;
+
+// 64 byte records of im3d_sdl3_gpu_draw_shapes and im3d_sdl3_gpu_draw_filled_shapes in
+// Instance_Buffer, see Shape_Record.
+struct Shape {
+  uint   first_line;
+  uint   type;
+  uint   detail;
+  uint   adaptive;
+  float3 position;
+  float  radius;
+  float3 direction;
+  float  size;
   uint   color;
 };
 
-StructuredBuffer<Vertex_Data> Data_Buffer : register(t0, space0);
+Shape load_shape(uint index) {
+  uint  offset = (shape_offset + index) * 64u;
+  uint4 data_0 = Instance_Buffer.Load4(offset);
+  uint4 data_1 = Instance_Buffer.Load4(offset + 16u);
+  uint4 data_2 = Instance_Buffer.Load4(offset + 32u);
+  Shape shape;
+  shape.first_line = data_0.x;
+  shape.type       = data_0.y;
+  shape.detail     = data_0.z;
+  shape.adaptive   = data_0.w;
+  shape.position   = asfloat(data_1.xyz);
+  shape.radius     = asfloat(data_1.w);
+  shape.direction  = asfloat(data_2.xyz);
+  shape.size       = asfloat(data_2.w);
+  shape.color      = Instance_Buffer.Load(offset + 48u);
+  return shape;
+}
+#endif
+
+#if defined(SHAPE_IMPOSTORS)
+struct Input {
+  float4 position : TEXCOORD0;
+  uint   instance_id : SV_InstanceID;
+};
+
+// The ray through each pixel runs from the near to the far plane, their homogeneous world positions
+// are linear in screen space.
+struct Output {
+  noperspective float4   ray_start : TEXCOORD0;
+  noperspective float4   ray_end : TEXCOORD1;
+  nointerpolation float4 capsule_start : TEXCOORD2;  // Radius in w.
+  nointerpolation float3 capsule_end : TEXCOORD3;
+  nointerpolation float4 color : TEXCOORD4;
+  nointerpolation float4 depth_z : TEXCOORD5;  // Rows of world_to_clip_transform, for the depth.
+  nointerpolation float4 depth_w : TEXCOORD6;
+  float4                 position : SV_Position;
+};
+
+// Covers the shape's bounding box on screen with a quad, spheres are capsules of zero length.
+Output main(Input input) {
+  Output output = (Output)0;
+
+  Shape  shape = load_shape(input.instance_id);
+  float3 start = shape.position;
+  float3 end   = shape.type == SHAPE_CAPSULE ? shape.position + shape.direction : shape.position;
+
+  float3 box_min  = min(start, end) - shape.radius;
+  float3 box_max  = max(start, end) + shape.radius;
+  float2 rect_min = float2(1.0e9, 1.0e9);
+  float2 rect_max = float2(-1.0e9, -1.0e9);
+  uint   behind   = 0u;
+  for (uint i = 0u; i < 8u; ++i) {
+    float3 corner = lerp(box_min, box_max, float3(i & 1u, (i >> 1u) & 1u, (i >> 2u) & 1u));
+    float4 clip   = mul(world_to_clip_transform, float4(corner, 1.0));
+    if (clip.w <= 0.0) {
+      behind++;
+    } else {
+      rect_min = min(rect_min, clip.xy / clip.w);
+      rect_max = max(rect_max, clip.xy / clip.w);
+    }
+  }
+  // Corners behind the view don't project, the quad covers the whole screen when only some are.
+  if (behind > 0u) {
+    rect_min = float2(-1.0, -1.0);
+    rect_max = float2(1.0, 1.0);
+  }
+  rect_min = max(rect_min, -1.0);
+  rect_max = min(rect_max, 1.0);
+  if (behind == 8u || any(rect_min >= rect_max)) {
+    output.position = float4(0.0, 0.0, 0.0, 1.0);
+    return output;
+  }
+
+  float2 ndc           = lerp(rect_min, rect_max, input.position.xy * 0.5 + 0.5);
+  output.position      = float4(ndc, 0.0, 1.0);
+  output.ray_start     = mul(clip_to_world_transform, float4(ndc, 0.0, 1.0));
+  output.ray_end       = mul(clip_to_world_transform, float4(ndc, 1.0, 1.0));
+  output.capsule_start = float4(start, shape.radius);
+  output.capsule_end   = end;
+  output.color         = uint_to_rgba(shape.color);
+  output.depth_z       = world_to_clip_transform[2];
+  output.depth_w       = world_to_clip_transform[3];
+  return output;
+}
+#elif defined(TEXT_GLYPHS)
+struct Input {
+  float4 position : TEXCOORD0;
+  uint   instance_id : SV_InstanceID;
+};
+
+struct Output {
+  float2                 texcoord : TEXCOORD0;
+  nointerpolation float4 color : TEXCOORD1;
+  nointerpolation uint   msdf : TEXCOORD2;
+  float4                 position : SV_Position;
+};
+
+// Expands a 32 byte Glyph_Instance of Instance_Buffer into a quad over its glyph's plane rect, in
+// pixels from the text's position on screen. The 32 byte glyph records in Data_Buffer are the plane
+// rect and the uv rect, see Glyph_Record.
+Output main(Input input) {
+  Output output = (Output)0;
+
+  uint   offset     = (text_offset + input.instance_id) * 32u;
+  uint4  data_0     = Instance_Buffer.Load4(offset);
+  uint4  data_1     = Instance_Buffer.Load4(offset + 16u);
+  float4 plane_rect = asfloat(Data_Buffer.Load4(data_1.z * 32u));
+  float4 uv_rect    = asfloat(Data_Buffer.Load4(data_1.z * 32u + 16u));
+
+  // Text behind the view is not drawn.
+  float4 clip = mul(world_to_clip_transform, float4(asfloat(data_0.xyz), 1.0));
+  if (clip.w <= 0.0) {
+    output.position = float4(0.0, 0.0, 0.0, 1.0);
+    return output;
+  }
 
+  float2 corner   = input.position.xy * 0.5 + 0.5;
+  float2 pixels   = asfloat(data_1.xy) + lerp(plane_rect.xy, plane_rect.zw, corner);
+  pixels         *= asfloat(data_0.w);
+  clip.xy        += float2(pixels.x, -pixels.y) * (2.0 / resolution) * clip.w;
+  output.position = clip;
+  output.texcoord = lerp(uv_rect.xy, uv_rect.zw, corner);
+  output.color    = uint_to_rgba(data_1.w);
+  output.msdf     = text_msdf;
+  return output;
+}
+#elif defined(OVERLAY_COMPOSITE)
+struct Input {
+  uint vertex_id : SV_VertexID;
+};
+
+struct Output {
+  float2 texcoord : TEXCOORD0;
+  float4 position : SV_Position;
+};
+
+// A single triangle covering the viewport, the overlay is drawn into the top left of its target.
+Output main(Input input) {
+  float2 corner = float2((input.vertex_id << 1u) & 2u, input.vertex_id & 2u);
+  Output output;
+  output.position = float4(corner.x * 2.0 - 1.0, 1.0 - corner.y * 2.0, 0.0, 1.0);
+  output.texcoord = corner * overlay_texcoord_scale;
+  return output;
+}
+#else
+// Indexed and mesh triangles have no vertex buffer bound, their vertex ids are indices into the
+// draw list or the mesh.
 struct Input {
+#if !(defined(PRIMITIVE_KIND_TRIANGLES) && (defined(INDEXED_TRIANGLES) || defined(MESH_INSTANCES)))
   float4 position : TEXCOORD0;
+#endif
   uint   vertex_id : SV_VertexID;
   uint   instance_id : SV_InstanceID;
 };
@@ -19,58 +521,263 @@ struct Output {
   noperspective float2 texcoord : TEXCOORD0;
 #elif defined(PRIMITIVE_KIND_LINES)
   noperspective float edge_distance : TEXCOORD0;
+#elif defined(PRIMITIVE_KIND_TRIANGLES)
+  noperspective float3 edge_distance : TEXCOORD0;  // Pixels inside each edge of the triangle.
 #endif
   noperspective float size : TEXCOORD1;
   float4              color : TEXCOORD2;
   float4              position : SV_Position;
 };
 
-cbuffer Uniform_Block : register(b0, space1) {
-  float4x4 world_to_clip_transform : packoffset(c0);
-  float2   resolution : packoffset(c4);
-  uint     instance_offset : packoffset(c4.z);
+#if defined(MESH_INSTANCES)
+// 64 byte records of im3d_sdl3_gpu_draw_mesh_instances in Instance_Buffer, the mesh vertices are
+// float4 records in Data_Buffer, xyz position and w size scale.
+struct Mesh_Instance {
+  float4 transform[3];
+  uint   color;
+  float  size;
+};
+
+Mesh_Instance load_mesh_instance(uint index) {
+  uint          offset = (mesh_instance_offset + index) * 64u;
+  Mesh_Instance instance;
+  instance.transform[0] = asfloat(Instance_Buffer.Load4(offset));
+  instance.transform[1] = asfloat(Instance_Buffer.Load4(offset + 16u));
+  instance.transform[2] = asfloat(Instance_Buffer.Load4(offset + 32u));
+  instance.color        = Instance_Buffer.Load(offset + 48u);
+  instance.size         = asfloat(Instance_Buffer.Load(offset + 52u));
+  return instance;
 }
 
-float4 uint_to_rgba(uint u) {
-  float4 color = float4(0.0, 0.0, 0.0, 0.0);
-  color.r      = float((u & 0xff000000u) >> 24u) / 255.0;
-  color.g      = float((u & 0x00ff0000u) >> 16u) / 255.0;
-  color.b      = float((u & 0x0000ff00u) >> 8u) / 255.0;
-  color.a      = float((u & 0x000000ffu) >> 0u) / 255.0;
-  return color;
+// The mesh instance takes the place of the draw segment.
+Vertex_Data load_vertex_data(Mesh_Instance instance, uint index) {
+  float4      vertex = asfloat(Data_Buffer.Load4(index * 16u));
+  Vertex_Data vertex_data;
+  vertex_data.position.x = dot(instance.transform[0], float4(vertex.xyz, 1.0));
+  vertex_data.position.y = dot(instance.transform[1], float4(vertex.xyz, 1.0));
+  vertex_data.position.z = dot(instance.transform[2], float4(vertex.xyz, 1.0));
+  vertex_data.size       = instance.size * vertex.w;
+  vertex_data.color      = instance.color;
+  return vertex_data;
+}
+#endif
+
+#if defined(PARAMETRIC_SHAPES)
+// Finds the shape that line_id belongs to, the shapes are sorted by their first line.
+uint find_shape(uint line_id) {
+  uint first = 0u;
+  uint last  = shape_count - 1u;
+  while (first < last) {
+    uint middle = (first + last + 1u) / 2u;
+    if (Instance_Buffer.Load((shape_offset + middle) * 64u) <= line_id) {
+      first = middle;
+    } else {
+      last = middle - 1u;
+    }
+  }
+  return first;
+}
+
+// Orthonormal basis around the unit vector n, from "Building an Orthonormal Basis, Revisited".
+void make_basis(float3 n, out float3 t, out float3 b) {
+  float s = n.z >= 0.0 ? 1.0 : -1.0;
+  float a = -1.0 / (s + n.z);
+  float c = n.x * n.y * a;
+  t       = float3(1.0 + s * n.x * n.x * a, s * c, -s * n.x);
+  b       = float3(c, s + n.y * n.y * a, -n.y);
+}
+
+// Screen space length of the radius along t and b, the longer of the two.
+float shape_pixel_radius(Shape shape, float3 t, float3 b) {
+  float4 center = mul(world_to_clip_transform, float4(shape.position, 1.0));
+  float4 edge_t = mul(world_to_clip_transform, float4(shape.position + t * shape.radius, 1.0));
+  float4 edge_b = mul(world_to_clip_transform, float4(shape.position + b * shape.radius, 1.0));
+  if (min(center.w, min(edge_t.w, edge_b.w)) <= 0.0) { return 1.0e6; }
+
+  float2 pixels_t = (edge_t.xy / edge_t.w - center.xy / center.w) * resolution * 0.5;
+  float2 pixels_b = (edge_b.xy / edge_b.w - center.xy / center.w) * resolution * 0.5;
+  return max(length(pixels_t), length(pixels_b));
+}
+
+// A line of a shape, collapsed when it is past the shape's adaptive detail.
+struct Shape_Line {
+  float3 position_0;
+  float3 position_1;
+  float  size;
+  uint   color;
+  bool   collapsed;
+};
+
+// Ring centers, capsule profiles are around the end for the first half and the start for the
+// second, picked by the middle of the line so that both its ends are on the same half circle.
+float3 shape_ring_center(Shape shape, uint ring, float middle_angle) {
+  if (shape.type == SHAPE_CAPSULE) {
+    bool end = ring == 1u || (ring >= 2u && sin(middle_angle) >= 0.0);
+    return end ? shape.position + shape.direction : shape.position;
+  }
+  return shape.position;
+}
+
+float3 shape_ring_point(Shape shape, uint ring, float3 center, float3 axis, float3 t, float3 b,
+                        float angle) {
+  float c = cos(angle);
+  float s = sin(angle);
+  if (shape.type == SHAPE_SPHERE) {
+    float3 offset = ring == 0u ? float3(c, s, 0.0) : ring == 1u ? float3(c, 0.0, s)
+                                                                 : float3(0.0, c, s);
+    return center + offset * shape.radius;
+  }
+  if (shape.type == SHAPE_CAPSULE && ring >= 2u) {
+    return center + ((ring == 2u ? t : b) * c + axis * s) * shape.radius;
+  }
+  return center + (t * c + b * s) * shape.radius;
+}
+
+// Circles have one ring, spheres three (like Im3d::DrawSphere), capsules one at each end and two
+// profiles, and cones their base. Capsules and cones add four lines along their sides after the
+// rings. Adaptive shapes reserve their maximum detail and collapse the lines they don't need.
+Shape_Line load_shape_line(uint line_id) {
+  Shape  shape  = load_shape(find_shape(line_id));
+  uint   line   = line_id - shape.first_line;
+  float  height = length(shape.direction);
+  float3 axis   = height > 0.0 ? shape.direction / height : float3(0.0, 1.0, 0.0);
+  float3 t, b;
+  make_basis(axis, t, b);
+
+  uint detail = shape.detail;
+  if (shape.adaptive != 0u) {
+    detail = clamp(uint(shape_pixel_radius(shape, t, b) * 0.5), 8u, shape.detail);
+    detail += detail % 2u;
+  }
+
+  uint ring_count = shape.type == SHAPE_SPHERE ? 3u : shape.type == SHAPE_CAPSULE ? 4u : 1u;
+
+  Shape_Line result;
+  result.size      = shape.size;
+  result.color     = shape.color;
+  result.collapsed = false;
+  if (line < ring_count * shape.detail) {
+    uint   ring    = line / shape.detail;
+    uint   segment = line % shape.detail;
+    float  angle_0 = TWO_PI * float(segment) / float(detail);
+    float  angle_1 = TWO_PI * float(segment + 1u) / float(detail);
+    float3 center  = shape_ring_center(shape, ring, (angle_0 + angle_1) * 0.5);
+    result.position_0 = shape_ring_point(shape, ring, center, axis, t, b, angle_0);
+    result.position_1 = shape_ring_point(shape, ring, center, axis, t, b, angle_1);
+    result.collapsed  = segment >= detail;
+  } else {
+    uint   side_index = line - ring_count * shape.detail;
+    float3 side       = ((side_index & 1u) == 0u ? t : b) * ((side_index & 2u) == 0u ? 1.0 : -1.0);
+    result.position_0 = shape.position + side * shape.radius;
+    result.position_1 = shape.type == SHAPE_CONE ? shape.position + shape.direction
+                                                 : result.position_0 + shape.direction;
+  }
+  return result;
+}
+
+// The shape line takes the place of the draw segment, index 0 and 1 are its ends.
+Vertex_Data load_vertex_data(Shape_Line line, uint index) {
+  Vertex_Data vertex_data;
+  vertex_data.position = index == 0u ? line.position_0 : line.position_1;
+  vertex_data.size     = line.size;
+  vertex_data.color    = line.color;
+  return vertex_data;
 }
+#endif
+
+#if defined(PRIMITIVE_KIND_TRIANGLES) && !defined(INDEXED_TRIANGLES)
+// Moves the corner of the triangle out by TRIANGLE_ANTIALIASING pixels along both of its edges and
+// returns the distances of the moved corner inside each edge, which are linear in screen space.
+// Triangles crossing the view plane or without area are left as they are.
+void dilate_triangle(
+    float4 corners[3], uint corner, inout float4 position, inout float3 edge_distance) {
+  if (min(corners[0].w, min(corners[1].w, corners[2].w)) <= 0.0) { return; }
+
+  float2 pixels[3];
+  for (uint i = 0u; i < 3u; ++i) {
+    pixels[i] = corners[i].xy / corners[i].w * resolution * 0.5;
+  }
+  float2 edge_0 = pixels[1] - pixels[0];
+  float2 edge_1 = pixels[2] - pixels[0];
+  float  area   = edge_0.x * edge_1.y - edge_0.y * edge_1.x;
+  if (abs(area) < 1.0e-4) { return; }
+
+  // Edge i is opposite corner i, its outward normal depends on the winding.
+  float2 normals[3];
+  for (uint j = 0u; j < 3u; ++j) {
+    float2 edge = pixels[(j + 2u) % 3u] - pixels[(j + 1u) % 3u];
+    normals[j]  = normalize(float2(edge.y, -edge.x)) * sign(area);
+  }
+
+  // Long miters of sharp corners are clamped, their edges move out less.
+  float2 normal_0 = normals[(corner + 1u) % 3u];
+  float2 normal_1 = normals[(corner + 2u) % 3u];
+  float2 offset   = (normal_0 + normal_1) / max(1.0 + dot(normal_0, normal_1), 0.25);
+  offset         *= TRIANGLE_ANTIALIASING;
+  position.xy    += offset / (resolution * 0.5) * position.w;
+
+  float2 moved = pixels[corner] + offset;
+  for (uint k = 0u; k < 3u; ++k) {
+    edge_distance[k] = dot(pixels[(k + 1u) % 3u] - moved, normals[k]);
+  }
+}
+#endif
 
 Output main(Input input) {
   Output output;
 
+#if defined(MESH_INSTANCES)
+  // Line meshes draw an instance per line of each record, triangle meshes one per record.
+  Mesh_Instance segment      = load_mesh_instance(input.instance_id / mesh_primitive_count);
+  uint          first_vertex = (input.instance_id % mesh_primitive_count) * primitive_vertex_stride;
+  bool          collapsed    = false;
+#elif defined(PARAMETRIC_SHAPES)
+  Shape_Line segment      = load_shape_line(input.instance_id);
+  uint       first_vertex = 0u;
+  bool       collapsed    = segment.collapsed;
+#else
+  uint batch_instance_id = input.instance_id;
+  if (remap_instances != 0u) {
+    batch_instance_id = Instance_Buffer.Load((remap_offset + input.instance_id) * 4u);
+  }
+  Draw_Segment segment      = find_segment(batch_instance_id);
+  uint         instance_id  = batch_instance_id - segment.first_instance;
+  uint         first_vertex = segment.vertex_offset + instance_id * primitive_vertex_stride;
+  bool         collapsed    = is_strip_break(first_vertex);
+#endif
+
+  // Collapsing every vertex of the primitive to the same position leaves nothing to rasterize.
+  if (collapsed) {
+    output          = (Output)0;
+    output.position = float4(0.0, 0.0, 0.0, 1.0);
+    return output;
+  }
+
 #if defined(PRIMITIVE_KIND_POINTS)
-  Vertex_Data vertex_data = Data_Buffer[instance_offset + input.instance_id];
+  Vertex_Data vertex_data = load_vertex_data(segment, first_vertex);
 
-  output.size  = max(vertex_data.position_size.w, ANTIALIASING);
+  output.size  = max(vertex_data.size, ANTIALIASING);
   output.color = uint_to_rgba(vertex_data.color);
   output.color.a *= smoothstep(0.0, 1.0, output.size / ANTIALIASING);
 
-  output.position = mul(world_to_clip_transform, float4(vertex_data.position_size.xyz, 1.0));
+  output.position = mul(world_to_clip_transform, float4(vertex_data.position, 1.0));
   float2 scale    = 1.0 / resolution * output.size;
   output.position.xy += input.position.xy * scale * output.position.w;
 
   output.texcoord = input.position.xy * 0.5 + 0.5;
 
 #elif defined(PRIMITIVE_KIND_LINES)
-  uint        instance_id_0 = instance_offset + input.instance_id * 2;
-  uint        instance_id_1 = instance_id_0 + 1;
-  uint        instance_id   = (input.vertex_id % 2 == 0) ? instance_id_0 : instance_id_1;
-  Vertex_Data vertex_data   = Data_Buffer[instance_id];
+  Vertex_Data vertex_data_0 = load_vertex_data(segment, first_vertex);
+  Vertex_Data vertex_data_1 = load_vertex_data(segment, first_vertex + 1);
+  Vertex_Data vertex_data   = (input.vertex_id % 2 == 0) ? vertex_data_0 : vertex_data_1;
 
-  output.size  = max(vertex_data.position_size.w, ANTIALIASING);
+  output.size  = max(vertex_data.size, ANTIALIASING);
   output.color = uint_to_rgba(vertex_data.color);
   output.color.a *= smoothstep(0.0, 1.0, output.size / ANTIALIASING);
   output.edge_distance = output.size * input.position.y;
 
-  float4 pos_0 =
-      mul(world_to_clip_transform, float4(Data_Buffer[instance_id_0].position_size.xyz, 1.0));
-  float4 pos_1 =
-      mul(world_to_clip_transform, float4(Data_Buffer[instance_id_1].position_size.xyz, 1.0));
+  float4 pos_0     = mul(world_to_clip_transform, float4(vertex_data_0.position, 1.0));
+  float4 pos_1     = mul(world_to_clip_transform, float4(vertex_data_1.position, 1.0));
   float2 direction = (pos_0.xy / pos_0.w) - (pos_1.xy / pos_1.w);
   direction        = normalize(float2(direction.x, direction.y * resolution.y / resolution.x));
   float2 tng       = float2(-direction.y, direction.x) * output.size / resolution;
@@ -79,22 +786,150 @@ Output main(Input input) {
   output.position.xy += tng * input.position.y * output.position.w;
 
 #elif defined(PRIMITIVE_KIND_TRIANGLES)
-  Vertex_Data vertex_data =
-      Data_Buffer[(instance_offset + input.instance_id * 3) + input.vertex_id];
-  output.color    = uint_to_rgba(vertex_data.color);
-  output.position = mul(world_to_clip_transform, float4(vertex_data.position_size.xyz, 1.0));
+  Vertex_Data vertex_data = load_vertex_data(segment, first_vertex + input.vertex_id);
+  output.color         = uint_to_rgba(vertex_data.color);
+  output.position      = mul(world_to_clip_transform, float4(vertex_data.position, 1.0));
+  output.edge_distance = float3(1.0e4, 1.0e4, 1.0e4);
+#if !defined(INDEXED_TRIANGLES)
+  // Indexed vertices are shared between triangles and can't be moved out along the edges of any
+  // one of them. Without MSAA indexed triangles arrive here expanded, with MSAA they need no fade.
+  // The border of a translucent triangle would be blended over its neighbours a second time and
+  // show up as seams between them, so only opaque triangles are dilated.
+  if (triangle_antialiasing != 0u) {
+    uint   corner       = input.vertex_id % 3u;
+    uint   first_corner = first_vertex + input.vertex_id - corner;
+    float4 corners[3];
+    float  min_alpha = 1.0;
+    for (uint i = 0u; i < 3u; ++i) {
+      Vertex_Data corner_data = load_vertex_data(segment, first_corner + i);
+      corners[i] = mul(world_to_clip_transform, float4(corner_data.position, 1.0));
+      min_alpha  = min(min_alpha, uint_to_rgba(corner_data.color).a);
+    }
+    if (min_alpha >= 1.0) {
+      dilate_triangle(corners, corner, output.position, output.edge_distance);
+    }
+  }
+#endif
 #endif
 
   return output;
 }
 #endif
+#endif
 
 #if defined(FRAGMENT_SHADER)
+#if defined(SHAPE_IMPOSTORS)
+struct Input {
+  noperspective float4   ray_start : TEXCOORD0;
+  noperspective float4   ray_end : TEXCOORD1;
+  nointerpolation float4 capsule_start : TEXCOORD2;
+  nointerpolation float3 capsule_end : TEXCOORD3;
+  nointerpolation float4 color : TEXCOORD4;
+  nointerpolation float4 depth_z : TEXCOORD5;
+  nointerpolation float4 depth_w : TEXCOORD6;
+};
+
+struct Output {
+  float4 color : SV_Target0;
+  float  depth : SV_Depth;
+};
+
+// Distance along the unit ray to the sphere's surface, negative when the ray misses it.
+float intersect_sphere(float3 ray_origin, float3 ray_direction, float3 center, float radius) {
+  float3 offset = ray_origin - center;
+  float  b      = dot(ray_direction, offset);
+  float  h      = b * b - dot(offset, offset) + radius * radius;
+  return h < 0.0 ? -1.0 : -b - sqrt(h);
+}
+
+// Distance along the unit ray to the capsule's surface, negative when the ray misses it. The
+// cylinder is intersected first, see https://iquilezles.org/articles/intersectors.
+float intersect_capsule(float3 ray_origin, float3 ray_direction, float3 start, float3 end,
+                        float radius) {
+  float3 axis       = end - start;
+  float3 offset     = ray_origin - start;
+  float  axis_axis  = dot(axis, axis);
+  float  axis_ray   = dot(axis, ray_direction);
+  float  axis_start = dot(axis, offset);
+  float  a          = axis_axis - axis_ray * axis_ray;
+  if (a > 1.0e-6 * axis_axis) {
+    float b = axis_axis * dot(ray_direction, offset) - axis_start * axis_ray;
+    float c = axis_axis * dot(offset, offset) - axis_start * axis_start -
+              radius * radius * axis_axis;
+    float h = b * b - a * c;
+    if (h < 0.0) { return -1.0; }
+
+    float t = (-b - sqrt(h)) / a;
+    float y = axis_start + t * axis_ray;
+    if (y > 0.0 && y < axis_axis) { return t; }
+    return intersect_sphere(ray_origin, ray_direction, y <= 0.0 ? start : end, radius);
+  }
+
+  // Spheres, and capsules seen along their axis, only show their caps.
+  float t_start = intersect_sphere(ray_origin, ray_direction, start, radius);
+  float t_end   = intersect_sphere(ray_origin, ray_direction, end, radius);
+  if (t_start < 0.0) { return t_end; }
+  if (t_end < 0.0) { return t_start; }
+  return min(t_start, t_end);
+}
+
+Output main(Input input) {
+  float3 ray_origin    = input.ray_start.xyz / input.ray_start.w;
+  float3 ray_direction = normalize(input.ray_end.xyz / input.ray_end.w - ray_origin);
+  float  t             = intersect_capsule(
+      ray_origin,
+      ray_direction,
+      input.capsule_start.xyz,
+      input.capsule_end,
+      input.capsule_start.w);
+  if (t < 0.0) { discard; }
+
+  float4 hit = float4(ray_origin + ray_direction * t, 1.0);
+  Output output;
+  output.color = input.color;
+  output.depth = dot(input.depth_z, hit) / dot(input.depth_w, hit);
+  return output;
+}
+#elif defined(TEXT_GLYPHS)
+Texture2D<float4> Font_Texture : register(t0, space2);
+SamplerState      Font_Sampler : register(s0, space2);
+
+struct Input {
+  float2                 texcoord : TEXCOORD0;
+  nointerpolation float4 color : TEXCOORD1;
+  nointerpolation uint   msdf : TEXCOORD2;
+};
+
+// The distance is 0.5 on the glyph's edge, which fades over a pixel at any text size.
+float4 main(Input input) : SV_Target0 {
+  float4 texel = Font_Texture.Sample(Font_Sampler, input.texcoord);
+  float  d     = texel.r;
+  if (input.msdf != 0u) { d = max(min(texel.r, texel.g), min(max(texel.r, texel.g), texel.b)); }
+
+  float4 result = input.color;
+  result.a *= saturate((d - 0.5) / max(fwidth(d), 1.0e-5) + 0.5);
+  return result;
+}
+#elif defined(OVERLAY_COMPOSITE)
+Texture2D<float4> Overlay_Texture : register(t0, space2);
+SamplerState      Overlay_Sampler : register(s0, space2);
+
+struct Input {
+  float2 texcoord : TEXCOORD0;
+};
+
+// The overlay holds premultiplied colors, which upsample without dark fringes.
+float4 main(Input input) : SV_Target0 {
+  return Overlay_Texture.Sample(Overlay_Sampler, input.texcoord);
+}
+#else
 struct Input {
 #if defined(PRIMITIVE_KIND_POINTS)
   noperspective float2 texcoord : TEXCOORD0;
 #elif defined(PRIMITIVE_KIND_LINES)
   noperspective float edge_distance : TEXCOORD0;
+#elif defined(PRIMITIVE_KIND_TRIANGLES)
+  noperspective float3 edge_distance : TEXCOORD0;
 #endif
   noperspective float size : TEXCOORD1;
   float4              color : TEXCOORD2;
@@ -111,8 +946,16 @@ float4 main(Input input) : SV_Target0 {
   float d = length(input.texcoord - 0.5);
   d       = smoothstep(0.5, 0.5 - (ANTIALIASING / input.size), d);
   result.a *= d;
+#elif defined(PRIMITIVE_KIND_TRIANGLES)
+  // Only the dilated border fades, edges shared by two triangles are covered by both. The outer
+  // half of the border is discarded so that it doesn't write depth around the triangle.
+  float d        = min(input.edge_distance.x, min(input.edge_distance.y, input.edge_distance.z));
+  float coverage = saturate(1.0 + d / TRIANGLE_ANTIALIASING);
+  if (coverage < 0.5) { discard; }
+  result.a *= coverage;
 #endif
 
   return result;
 }
 #endif
+#endif
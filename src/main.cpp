@@ -10,14 +10,19 @@
 #include <imgui_impl_sdl3.h>
 #include <imgui_impl_sdlgpu3.h>
 
+// The label font is rasterized with ImGui's copy of stb_truetype.
+#define STB_TRUETYPE_IMPLEMENTATION
+#define STBTT_STATIC
+#include <imstb_truetype.h>
+
 #include <new>
 
 struct App_State {
   SDL_GPUDevice*       device;
   SDL_Window*          window;
   SDL_GPUTextureFormat swapchain_texture_format;
-  SDL_GPUTexture*      render_target_color_texture;
-  SDL_GPUTexture*      render_target_resolve_texture;
+  SDL_GPUTextureFormat depth_texture_format;
+  SDL_GPUTexture*      render_target_depth_texture;
   float                content_scale;
   HMM_Vec2             window_size_pixels;
   bool                 window_minimized;
@@ -34,7 +39,8 @@ struct App_State {
   HMM_Vec2             last_mouse_position;
   float                mouse_scroll;
 
-  ImFont* imgui_font;
+  ImFont*         imgui_font;
+  SDL_GPUTexture* label_font_atlas;
 
   Camera camera;
 };
@@ -49,6 +55,7 @@ static bool is_mouse_button_pressed(App_State* as, int button);
 static bool is_mouse_button_released(App_State* as, int button);
 static void on_window_size_changed(App_State* as, int w, int h);
 static void on_display_content_scale_changed(App_State* as, float content_scale);
+static bool create_label_font(App_State* as);
 
 SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[]) {
   if (!SDL_Init(SDL_INIT_VIDEO)) {
@@ -127,13 +134,45 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[]) {
       SDL_GPU_SWAPCHAINCOMPOSITION_SDR,
       SDL_GPU_PRESENTMODE_VSYNC);
   as->swapchain_texture_format = SDL_GetGPUSwapchainTextureFormat(as->device, as->window);
+  as->depth_texture_format     = SDL_GPU_TEXTUREFORMAT_INVALID;
+  {
+    SDL_GPUTextureFormat depth_formats[] = {
+        SDL_GPU_TEXTUREFORMAT_D32_FLOAT,
+        SDL_GPU_TEXTUREFORMAT_D24_UNORM,
+        SDL_GPU_TEXTUREFORMAT_D32_FLOAT_S8_UINT,
+        SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT,
+    };
+    for (SDL_GPUTextureFormat format : depth_formats) {
+      if (SDL_GPUTextureSupportsFormat(
+              as->device,
+              format,
+              SDL_GPU_TEXTURETYPE_2D,
+              SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET)) {
+        as->depth_texture_format = format;
+        break;
+      }
+    }
+  }
+  if (as->depth_texture_format == SDL_GPU_TEXTUREFORMAT_INVALID) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to find a supported depth texture format");
+    return SDL_APP_FAILURE;
+  }
 
   {
     Im3d_SDL3_GPU_Init_Info info = {};
     info.device                  = as->device;
     info.color_target_format     = as->swapchain_texture_format;
-    info.msaa_samples            = SDL_GPU_SAMPLECOUNT_4;
+    info.msaa_samples            = SDL_GPU_SAMPLECOUNT_1;
+    info.depth_stencil_format    = as->depth_texture_format;
+    info.buffer_shrink_frames    = 120;
+    info.zero_copy_emission      = true;
+    info.copy_thread_count       = SDL_clamp(SDL_GetNumLogicalCPUCores() - 1, 0, 3);
+    info.cache_draw_lists        = true;
+    info.gpu_culling             = true;
     if (!im3d_sdl3_gpu_init(info)) { return SDL_APP_FAILURE; }
+
+    // The grid is opaque, so its draw lists can be batched in any order.
+    im3d_sdl3_gpu_set_layer_reorderable(Im3d::MakeId("Grid"), true);
   }
 
   {
@@ -161,6 +200,8 @@ SDL_AppResult SDL_AppInit(void** appstate, int argc, char* argv[]) {
     ImGui_ImplSDLGPU3_Init(&init_info);
   }
 
+  if (!create_label_font(as)) { return SDL_APP_FAILURE; }
+
   {
     int w, h;
     SDL_GetWindowSizeInPixels(as->window, &w, &h);
@@ -270,6 +311,31 @@ SDL_AppResult SDL_AppIterate(void* appstate) {
 
   Im3d::EndFrame();
 
+  // The uploads go into their own command buffer which is submitted before blocking on the
+  // swapchain, so filling the buffers overlaps the vsync wait and the previous frame's GPU work.
+  ImDrawData* draw_data = ImGui::GetDrawData();
+  if (!as->window_minimized) {
+    SDL_GPUCommandBuffer* upload_cmd_buf = SDL_AcquireGPUCommandBuffer(as->device);
+    if (upload_cmd_buf == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to acquire command buffer: %s",
+          SDL_GetError());
+      return SDL_APP_FAILURE;
+    }
+
+    im3d_sdl3_gpu_prepare_draw_data(upload_cmd_buf);
+    ImGui_ImplSDLGPU3_PrepareDrawData(draw_data, upload_cmd_buf);
+
+    if (!SDL_SubmitGPUCommandBuffer(upload_cmd_buf)) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to submit command buffer: %s",
+          SDL_GetError());
+      return SDL_APP_FAILURE;
+    }
+  }
+
   SDL_GPUCommandBuffer* cmd_buf = SDL_AcquireGPUCommandBuffer(as->device);
   if (cmd_buf == nullptr) {
     SDL_LogError(
@@ -294,37 +360,38 @@ SDL_AppResult SDL_AppIterate(void* appstate) {
   }
 
   if (swapchain_texture != nullptr && !as->window_minimized) {
-    im3d_sdl3_gpu_prepare_draw_data(cmd_buf);
-
-    ImDrawData* draw_data = ImGui::GetDrawData();
-    ImGui_ImplSDLGPU3_PrepareDrawData(draw_data, cmd_buf);
-
     {
       SDL_GPUColorTargetInfo target_info = {};
-      target_info.texture                = as->render_target_color_texture;
-      target_info.resolve_texture        = as->render_target_resolve_texture;
+      target_info.texture                = swapchain_texture;
       target_info.clear_color            = {0.308f, 0.306f, 0.3008f, 1.0001};
       target_info.load_op                = SDL_GPU_LOADOP_CLEAR;
-      target_info.store_op               = SDL_GPU_STOREOP_RESOLVE;
-      SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(cmd_buf, &target_info, 1, nullptr);
+      target_info.store_op               = SDL_GPU_STOREOP_STORE;
+
+      SDL_GPUDepthStencilTargetInfo depth_target_info = {};
+      depth_target_info.texture                       = as->render_target_depth_texture;
+      depth_target_info.clear_depth                   = 1.0f;
+      depth_target_info.load_op                       = SDL_GPU_LOADOP_CLEAR;
+      depth_target_info.store_op                      = SDL_GPU_STOREOP_DONT_CARE;
+      depth_target_info.stencil_load_op               = SDL_GPU_LOADOP_DONT_CARE;
+      depth_target_info.stencil_store_op              = SDL_GPU_STOREOP_DONT_CARE;
+
+      SDL_GPURenderPass* render_pass =
+          SDL_BeginGPURenderPass(cmd_buf, &target_info, 1, &depth_target_info);
       defer(SDL_EndGPURenderPass(render_pass));
 
       im3d_sdl3_gpu_render_draw_data(cmd_buf, render_pass);
-
-      ImGui_ImplSDLGPU3_RenderDrawData(draw_data, cmd_buf, render_pass);
     }
 
+    // ImGui's pipelines have no depth target, it gets a pass of its own.
     {
-      SDL_GPUBlitInfo info     = {};
-      info.source.texture      = as->render_target_resolve_texture;
-      info.source.w            = static_cast<uint32_t>(as->window_size_pixels.Width);
-      info.source.h            = static_cast<uint32_t>(as->window_size_pixels.Height);
-      info.destination.texture = swapchain_texture;
-      info.destination.w       = static_cast<uint32_t>(as->window_size_pixels.Width);
-      info.destination.h       = static_cast<uint32_t>(as->window_size_pixels.Height);
-      info.load_op             = SDL_GPU_LOADOP_DONT_CARE;
-      info.filter              = SDL_GPU_FILTER_LINEAR;
-      SDL_BlitGPUTexture(cmd_buf, &info);
+      SDL_GPUColorTargetInfo target_info = {};
+      target_info.texture                = swapchain_texture;
+      target_info.load_op                = SDL_GPU_LOADOP_LOAD;
+      target_info.store_op               = SDL_GPU_STOREOP_STORE;
+      SDL_GPURenderPass* render_pass = SDL_BeginGPURenderPass(cmd_buf, &target_info, 1, nullptr);
+      defer(SDL_EndGPURenderPass(render_pass));
+
+      ImGui_ImplSDLGPU3_RenderDrawData(draw_data, cmd_buf, render_pass);
     }
   }
 
@@ -348,6 +415,7 @@ void SDL_AppQuit(void* appstate, SDL_AppResult result) {
   ImGui::DestroyContext();
 
   im3d_sdl3_gpu_shutdown();
+  SDL_ReleaseGPUTexture(as->device, as->label_font_atlas);
 
   SDL_ReleaseWindowFromGPUDevice(as->device, as->window);
   SDL_DestroyWindow(as->window);
@@ -402,6 +470,12 @@ static void draw_demo(App_State* as) {
 
   ImGuiIO& io = ImGui::GetIO();
   ImGui::Text("Application average %.3f ms/frame (%.1f FPS)", 1000.0f / io.Framerate, io.Framerate);
+  Im3d_SDL3_GPU_Memory_Stats memory_stats = im3d_sdl3_gpu_get_memory_stats();
+  ImGui::Text(
+      "Im3d GPU memory %.2f MB (peak %.2f MB)",
+      static_cast<double>(memory_stats.current_bytes) / (1024.0 * 1024.0),
+      static_cast<double>(memory_stats.peak_bytes) / (1024.0 * 1024.0));
+  ImGui::Text("Im3d overlay scale %.2f", static_cast<double>(im3d_sdl3_gpu_get_overlay_scale()));
   ImGui::Spacing();
 
   if (ImGui::TreeNodeEx("Controls", ImGuiTreeNodeFlags_DefaultOpen)) {
@@ -665,10 +739,99 @@ static void draw_demo(App_State* as) {
     ImGui::TreePop();
   }
 
+  if (ImGui::TreeNodeEx("Mesh Instances")) {
+    static int instance_grid_size = 32;
+    ImGui::SliderInt("Instance Grid Size", &instance_grid_size, 1, 256);
+
+    // One record per sphere, all the rows end up in a single instanced draw.
+    Im3d_SDL3_GPU_Mesh_Instance row[256];
+    float                       half_size = (float)instance_grid_size * 0.5f;
+    for (int z = 0; z < instance_grid_size; ++z) {
+      for (int x = 0; x < instance_grid_size; ++x) {
+        Im3d::Vec3  position((float)x - half_size, 0.25f, (float)z - half_size);
+        Im3d::Color color(
+            (float)x / (float)instance_grid_size,
+            0.5f,
+            (float)z / (float)instance_grid_size,
+            1.0f);
+        row[x] = im3d_sdl3_gpu_mesh_instance(
+            Im3d::Mat4(position, Im3d::Mat3(1.0f), Im3d::Vec3(0.2f)),
+            color,
+            2.0f);
+      }
+      im3d_sdl3_gpu_draw_mesh_instances(IM3D_SDL3_GPU_MESH_SPHERE, row, instance_grid_size);
+    }
+
+    ImGui::TreePop();
+  }
+
+  if (ImGui::TreeNodeEx("Parametric Shapes")) {
+    static int shape_count = 16;
+    ImGui::SliderInt("Shape Count", &shape_count, 1, 256);
+
+    // The vertices are generated in the vertex shader, detail 0 adapts them to the size on screen.
+    Im3d_SDL3_GPU_Shape shapes[256];
+    for (int i = 0; i < shape_count; ++i) {
+      Im3d_SDL3_GPU_Shape& shape = shapes[i];
+      shape.type      = (Im3d_SDL3_GPU_Shape_Type)(i % 4);
+      shape.position  = Im3d::Vec3((float)(i % 16) * 2.0f - 15.0f, 1.0f, (float)(i / 16) * -2.0f);
+      shape.direction = Im3d::Vec3(0.0f, 1.0f, 0.0f);
+      shape.radius    = 0.5f;
+      shape.color     = Im3d::Color_Cyan;
+      shape.size      = 2.0f;
+      shape.detail    = 0;
+    }
+    im3d_sdl3_gpu_draw_shapes(shapes, (uint32_t)shape_count);
+
+    // Filled spheres and capsules are a quad each, ray cast per pixel.
+    static bool filled = false;
+    ImGui::Checkbox("Filled", &filled);
+    if (filled) {
+      for (int i = 0; i < shape_count; ++i) {
+        shapes[i].type  = (i % 2) == 0 ? IM3D_SDL3_GPU_SHAPE_SPHERE : IM3D_SDL3_GPU_SHAPE_CAPSULE;
+        shapes[i].color = Im3d::Color(0.0f, 0.5f, 0.5f, 1.0f);
+      }
+      im3d_sdl3_gpu_draw_filled_shapes(shapes, (uint32_t)shape_count);
+    }
+
+    ImGui::TreePop();
+  }
+
+  if (ImGui::TreeNodeEx("Text")) {
+    static int label_grid_size = 8;
+    ImGui::SliderInt("Label Grid Size", &label_grid_size, 1, 64);
+
+    // Every glyph is a single record, all the labels of the layer end up in one instanced draw.
+    float label_size = as->content_scale;
+    float half_size  = (float)label_grid_size * 0.5f;
+    for (int z = 0; z < label_grid_size; ++z) {
+      for (int x = 0; x < label_grid_size; ++x) {
+        Im3d::Vec3 position((float)x - half_size, 0.5f, (float)z - half_size);
+        Im3d::Text(
+            position,
+            label_size,
+            Im3d::Color_White,
+            Im3d::TextFlags_Default,
+            "%d, %d",
+            x,
+            z);
+      }
+    }
+    Im3d::Text(
+        Im3d::Vec3(0.0f, 2.0f, 0.0f),
+        label_size * 2.0f,
+        Im3d::Color_Yellow,
+        Im3d::TextFlags_AlignTop,
+        "Im3d::Text\nSigned distance field labels");
+
+    ImGui::TreePop();
+  }
+
   if (ImGui::TreeNodeEx("Grid", ImGuiTreeNodeFlags_DefaultOpen)) {
     static int grid_size = 20;
     ImGui::SliderInt("Grid Size", &grid_size, 1, 50);
     float grid_half_size = (float)grid_size * 0.5f;
+    Im3d::PushLayerId("Grid");
     Im3d::SetAlpha(1.0f);
     Im3d::SetSize(2.0f);
     Im3d::BeginLines();
@@ -681,6 +844,7 @@ static void draw_demo(App_State* as) {
       Im3d::Vertex((float)z - grid_half_size, 0.0f, grid_half_size, Im3d::Color_Blue);
     }
     Im3d::End();
+    Im3d::PopLayerId();
 
     ImGui::TreePop();
   }
@@ -726,40 +890,26 @@ static void on_window_size_changed(App_State* as, int w, int h) {
   texture_create_info.num_levels           = 1;
   texture_create_info.format               = as->swapchain_texture_format;
 
-  SDL_GPUTexture* color_texture;
+  SDL_GPUTexture* depth_texture;
   {
     SDL_GPUTextureCreateInfo info = texture_create_info;
-    info.usage                    = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET;
-    info.sample_count             = SDL_GPU_SAMPLECOUNT_4;
-    color_texture                 = SDL_CreateGPUTexture(as->device, &info);
-    if (color_texture == nullptr) {
+    info.format                   = as->depth_texture_format;
+    info.usage                    = SDL_GPU_TEXTUREUSAGE_DEPTH_STENCIL_TARGET;
+    info.sample_count             = SDL_GPU_SAMPLECOUNT_1;
+    depth_texture                 = SDL_CreateGPUTexture(as->device, &info);
+    if (depth_texture == nullptr) {
       SDL_LogError(
           SDL_LOG_CATEGORY_APPLICATION,
-          "Failed to create render target color texture: %s",
-          SDL_GetError());
-      return;
-    }
-  }
-  SDL_GPUTexture* resolve_texture;
-  {
-    SDL_GPUTextureCreateInfo info = texture_create_info;
-    info.usage      = SDL_GPU_TEXTUREUSAGE_COLOR_TARGET | SDL_GPU_TEXTUREUSAGE_SAMPLER;
-    resolve_texture = SDL_CreateGPUTexture(as->device, &info);
-    if (resolve_texture == nullptr) {
-      SDL_LogError(
-          SDL_LOG_CATEGORY_APPLICATION,
-          "Failed to create render target resolve_texture: %s",
+          "Failed to create render target depth texture: %s",
           SDL_GetError());
       return;
     }
   }
 
   SDL_WaitForGPUIdle(as->device);
-  SDL_ReleaseGPUTexture(as->device, as->render_target_color_texture);
-  SDL_ReleaseGPUTexture(as->device, as->render_target_resolve_texture);
+  SDL_ReleaseGPUTexture(as->device, as->render_target_depth_texture);
 
-  as->render_target_color_texture   = color_texture;
-  as->render_target_resolve_texture = resolve_texture;
+  as->render_target_depth_texture = depth_texture;
 }
 
 static void on_display_content_scale_changed(App_State* as, float content_scale) {
@@ -769,3 +919,173 @@ static void on_display_content_scale_changed(App_State* as, float content_scale)
   style.ScaleAllSizes(as->content_scale);
   style.FontScaleDpi = as->content_scale;
 }
+
+// Rasterizes a signed distance field atlas of printable ASCII from the ImGui font, for Im3d::Text.
+// An MSDF atlas generated offline with msdf-atlas-gen keeps glyph corners sharp at larger sizes.
+static bool create_label_font(App_State* as) {
+  static constexpr int   ATLAS_SIZE        = 512;
+  static constexpr int   FIRST_CODEPOINT   = 32;
+  static constexpr int   LAST_CODEPOINT    = 126;
+  static constexpr float SDF_PIXEL_HEIGHT  = 32.0f;
+  static constexpr int   SDF_PADDING       = 4;
+  static constexpr float FONT_PIXEL_HEIGHT = 18.0f;  // Of text size 1, like the ImGui font.
+
+  auto font_data = static_cast<const unsigned char*>(as->imgui_font->Sources[0]->FontData);
+  stbtt_fontinfo font_info;
+  if (!stbtt_InitFont(&font_info, font_data, stbtt_GetFontOffsetForIndex(font_data, 0))) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to read label font");
+    return false;
+  }
+  float sdf_scale   = stbtt_ScaleForPixelHeight(&font_info, SDF_PIXEL_HEIGHT);
+  float plane_scale = FONT_PIXEL_HEIGHT / SDF_PIXEL_HEIGHT;
+  int   ascent, descent, line_gap;
+  stbtt_GetFontVMetrics(&font_info, &ascent, &descent, &line_gap);
+
+  auto atlas_pixels = static_cast<uint8_t*>(SDL_calloc(ATLAS_SIZE * ATLAS_SIZE, 1));
+  if (atlas_pixels == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to allocate label font atlas");
+    return false;
+  }
+  defer(SDL_free(atlas_pixels));
+
+  // Glyphs are packed in rows, their distance is 0.5 on the edge and fades out over the padding.
+  Im3d_SDL3_GPU_Glyph glyphs[LAST_CODEPOINT - FIRST_CODEPOINT + 1] = {};
+  int                 pen_x      = 0;
+  int                 pen_y      = 0;
+  int                 row_height = 0;
+  for (int codepoint = FIRST_CODEPOINT; codepoint <= LAST_CODEPOINT; ++codepoint) {
+    int advance, left_side_bearing;
+    stbtt_GetCodepointHMetrics(&font_info, codepoint, &advance, &left_side_bearing);
+
+    Im3d_SDL3_GPU_Glyph& glyph = glyphs[codepoint - FIRST_CODEPOINT];
+    glyph.codepoint            = (uint32_t)codepoint;
+    glyph.advance              = (float)advance * sdf_scale * plane_scale;
+
+    // Blank glyphs have no distance field, they only advance the pen.
+    int            w, h, x_offset, y_offset;
+    unsigned char* sdf = stbtt_GetCodepointSDF(
+        &font_info,
+        sdf_scale,
+        codepoint,
+        SDF_PADDING,
+        128,
+        128.0f / (float)SDF_PADDING,
+        &w,
+        &h,
+        &x_offset,
+        &y_offset);
+    if (sdf == nullptr) { continue; }
+    defer(stbtt_FreeSDF(sdf, nullptr));
+
+    if (pen_x + w > ATLAS_SIZE) {
+      pen_x       = 0;
+      pen_y      += row_height;
+      row_height  = 0;
+    }
+    if (pen_y + h > ATLAS_SIZE) {
+      SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Label font atlas is too small");
+      return false;
+    }
+    for (int y = 0; y < h; ++y) {
+      SDL_memcpy(atlas_pixels + (pen_y + y) * ATLAS_SIZE + pen_x, sdf + y * w, (size_t)w);
+    }
+
+    float top        = (float)ascent * sdf_scale + (float)y_offset;
+    glyph.uv_rect    = Im3d::Vec4(
+        (float)pen_x / (float)ATLAS_SIZE,
+        (float)pen_y / (float)ATLAS_SIZE,
+        (float)(pen_x + w) / (float)ATLAS_SIZE,
+        (float)(pen_y + h) / (float)ATLAS_SIZE);
+    glyph.plane_rect = Im3d::Vec4(
+        (float)x_offset * plane_scale,
+        top * plane_scale,
+        (float)(x_offset + w) * plane_scale,
+        (top + (float)h) * plane_scale);
+
+    pen_x      += w;
+    row_height  = SDL_max(row_height, h);
+  }
+
+  {
+    SDL_GPUTextureCreateInfo info = {};
+    info.type                     = SDL_GPU_TEXTURETYPE_2D;
+    info.format                   = SDL_GPU_TEXTUREFORMAT_R8_UNORM;
+    info.usage                    = SDL_GPU_TEXTUREUSAGE_SAMPLER;
+    info.width                    = ATLAS_SIZE;
+    info.height                   = ATLAS_SIZE;
+    info.layer_count_or_depth     = 1;
+    info.num_levels               = 1;
+    as->label_font_atlas          = SDL_CreateGPUTexture(as->device, &info);
+    if (as->label_font_atlas == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create label font atlas: %s",
+          SDL_GetError());
+      return false;
+    }
+  }
+
+  SDL_GPUTransferBuffer* transfer_buffer;
+  {
+    SDL_GPUTransferBufferCreateInfo info = {};
+    info.size                            = ATLAS_SIZE * ATLAS_SIZE;
+    info.usage                           = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+    transfer_buffer                      = SDL_CreateGPUTransferBuffer(as->device, &info);
+    if (transfer_buffer == nullptr) {
+      SDL_LogError(
+          SDL_LOG_CATEGORY_APPLICATION,
+          "Failed to create transfer buffer: %s",
+          SDL_GetError());
+      return false;
+    }
+  }
+  defer(SDL_ReleaseGPUTransferBuffer(as->device, transfer_buffer));
+
+  void* mapped_data = SDL_MapGPUTransferBuffer(as->device, transfer_buffer, false);
+  if (mapped_data == nullptr) {
+    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Failed to map transfer buffer: %s", SDL_GetError());
+    return false;
+  }
+  SDL_memcpy(mapped_data, atlas_pixels, ATLAS_SIZE * ATLAS_SIZE);
+  SDL_UnmapGPUTransferBuffer(as->device, transfer_buffer);
+
+  SDL_GPUCommandBuffer* cmd_buf = SDL_AcquireGPUCommandBuffer(as->device);
+  if (cmd_buf == nullptr) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to acquire command buffer: %s",
+        SDL_GetError());
+    return false;
+  }
+  {
+    SDL_GPUTextureTransferInfo source = {};
+    source.transfer_buffer            = transfer_buffer;
+    source.pixels_per_row             = ATLAS_SIZE;
+    source.rows_per_layer             = ATLAS_SIZE;
+
+    SDL_GPUTextureRegion destination = {};
+    destination.texture              = as->label_font_atlas;
+    destination.w                    = ATLAS_SIZE;
+    destination.h                    = ATLAS_SIZE;
+    destination.d                    = 1;
+
+    SDL_GPUCopyPass* copy_pass = SDL_BeginGPUCopyPass(cmd_buf);
+    SDL_UploadToGPUTexture(copy_pass, &source, &destination, false);
+    SDL_EndGPUCopyPass(copy_pass);
+  }
+  if (!SDL_SubmitGPUCommandBuffer(cmd_buf)) {
+    SDL_LogError(
+        SDL_LOG_CATEGORY_APPLICATION,
+        "Failed to submit command buffer: %s",
+        SDL_GetError());
+    return false;
+  }
+
+  Im3d_SDL3_GPU_Font font = {};
+  font.type               = IM3D_SDL3_GPU_FONT_TYPE_SDF;
+  font.atlas              = as->label_font_atlas;
+  font.line_height        = (float)(ascent - descent + line_gap) * sdf_scale * plane_scale;
+  font.glyphs             = glyphs;
+  font.glyph_count        = SDL_arraysize(glyphs);
+  return im3d_sdl3_gpu_set_font(font);
+}
@@ -1,22 +1,124 @@
 #include <algorithm>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
 #include <vector>
 
-int main() {
-  std::ofstream out_file(OUT_DIR "/im3d_sdl3_gpu_shaders.h");
-  if (!out_file) {
-    std::cerr << "Failed to open output file\n";
-    return 1;
+// Packs the compiled shaders in .shaders into one blob per shader format, with a table of the
+// shaders in each blob, sorted by name. Pass --compress to compress each shader with the LZ4 block
+// format, decompress_shader in im3d_sdl3_gpu.cpp decodes it.
+
+struct Shader_Format {
+  const char* extension;
+  const char* define;
+};
+
+static const Shader_Format SHADER_FORMATS[] = {
+    {"dxil", "IM3D_SDL3_GPU_SHADERS_DXIL"},
+    {"spv", "IM3D_SDL3_GPU_SHADERS_SPIRV"},
+    {"msl", "IM3D_SDL3_GPU_SHADERS_MSL"},
+};
+
+struct Shader_Entry {
+  std::string name;
+  uint32_t    offset;
+  uint32_t    packed_size;
+  uint32_t    size;
+  uint64_t    hash;
+};
+
+// FNV-1a, matches hash_shader_code in im3d_sdl3_gpu.cpp.
+static uint64_t hash_shader_code(const std::vector<uint8_t>& data) {
+  uint64_t hash = 0xCBF29CE484222325ull;
+  for (uint8_t byte : data) {
+    hash ^= byte;
+    hash *= 0x100000001B3ull;
   }
+  return hash;
+}
 
-  out_file << "// clang-format off\n\n";
+// FNV-1a of the shader source without carriage returns, so that checkouts with either line ending
+// hash the same. The tests compare it against the source the header was generated from.
+static uint64_t hash_shader_source(const std::vector<uint8_t>& data) {
+  uint64_t hash = 0xCBF29CE484222325ull;
+  for (uint8_t byte : data) {
+    if (byte == '\r') continue;
+    hash ^= byte;
+    hash *= 0x100000001B3ull;
+  }
+  return hash;
+}
 
-  out_file << "#pragma once\n\n";
-  out_file << "#include <cstdint>\n\n";
+static void write_length(std::vector<uint8_t>& out, size_t length) {
+  for (; length >= 255; length -= 255) out.push_back(255);
+  out.push_back(static_cast<uint8_t>(length));
+}
+
+// Greedy LZ4 block compression. As the LZ4 block format requires, the last match starts at least
+// 12 bytes before the end and the last 5 bytes are literals, the last sequence only has literals.
+static std::vector<uint8_t> compress(const std::vector<uint8_t>& data) {
+  constexpr uint32_t HASH_BITS     = 12;
+  constexpr size_t   MIN_MATCH     = 4;
+  constexpr size_t   MAX_DIST      = 65535;
+  constexpr size_t   LAST_LITERALS = 5;
+  constexpr size_t   MATCH_LIMIT   = 12;
+
+  std::vector<uint8_t> out;
+  std::vector<size_t>  table(size_t(1) << HASH_BITS, SIZE_MAX);
+  size_t               anchor = 0;
+  size_t               i      = 0;
+  while (i + MATCH_LIMIT <= data.size()) {
+    uint32_t word;
+    std::memcpy(&word, &data[i], sizeof(word));
+    uint32_t slot      = (word * 2654435761u) >> (32 - HASH_BITS);
+    size_t   candidate = table[slot];
+    table[slot]        = i;
+    if (candidate == SIZE_MAX || i - candidate > MAX_DIST ||
+        std::memcmp(&data[candidate], &data[i], MIN_MATCH) != 0) {
+      i++;
+      continue;
+    }
+
+    size_t match_end    = data.size() - LAST_LITERALS;
+    size_t match_length = MIN_MATCH;
+    while (i + match_length < match_end &&
+           data[candidate + match_length] == data[i + match_length])
+      match_length++;
+
+    size_t literal_length = i - anchor;
+    size_t offset         = i - candidate;
+    size_t token_match    = std::min<size_t>(match_length - MIN_MATCH, 15);
+    out.push_back(static_cast<uint8_t>(std::min<size_t>(literal_length, 15) << 4 | token_match));
+    if (literal_length >= 15) write_length(out, literal_length - 15);
+    out.insert(out.end(), data.begin() + anchor, data.begin() + i);
+    out.push_back(static_cast<uint8_t>(offset));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    if (match_length - MIN_MATCH >= 15) write_length(out, match_length - MIN_MATCH - 15);
+
+    i      += match_length;
+    anchor  = i;
+  }
+
+  size_t literal_length = data.size() - anchor;
+  out.push_back(static_cast<uint8_t>(std::min<size_t>(literal_length, 15) << 4));
+  if (literal_length >= 15) write_length(out, literal_length - 15);
+  out.insert(out.end(), data.begin() + anchor, data.end());
+  return out;
+}
 
+int main(int argc, char** argv) {
+  bool compress_shaders = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--compress") == 0) compress_shaders = true;
+  }
+
+  // The shaders of each format, by file name without the format extension.
+  std::map<std::string, std::map<std::string, std::vector<uint8_t>>> shaders;
   for (const auto& entry : std::filesystem::directory_iterator(".shaders")) {
     if (!entry.is_regular_file()) continue;
 
@@ -31,21 +133,128 @@ int main() {
         std::istreambuf_iterator<char>());
     in_file.close();
 
-    std::string var_name = entry.path().filename().string();
-    std::replace(var_name.begin(), var_name.end(), '.', '_');
+    std::string extension = entry.path().extension().string();
+    if (!extension.empty()) extension.erase(0, 1);
+    shaders[extension][entry.path().stem().string()] = std::move(data);
+  }
+
+  std::ifstream source_file(OUT_DIR "/im3d_sdl3_gpu.hlsl", std::ios::binary);
+  if (!source_file) {
+    std::cerr << "Failed to open: " OUT_DIR "/im3d_sdl3_gpu.hlsl\n";
+    return 1;
+  }
+  std::vector<uint8_t> source(
+      (std::istreambuf_iterator<char>(source_file)),
+      std::istreambuf_iterator<char>());
+  source_file.close();
+
+  std::ofstream out_file(OUT_DIR "/im3d_sdl3_gpu_shaders.h");
+  if (!out_file) {
+    std::cerr << "Failed to open output file\n";
+    return 1;
+  }
+
+  out_file << "// clang-format off\n\n";
+
+  out_file << "#pragma once\n\n";
+  out_file << "#include <cstdint>\n\n";
+
+  // Only the formats with compiled shaders can be embedded, the backend reports the others at init.
+  std::vector<const Shader_Format*> formats;
+  for (const Shader_Format& format : SHADER_FORMATS) {
+    if (shaders.count(format.extension) > 0) formats.push_back(&format);
+  }
+
+  if (!formats.empty()) {
+    out_file << "// Define any of";
+    for (const Shader_Format* format : formats) out_file << " " << format->define;
+    out_file << " to only\n";
+    out_file << "// embed the shaders of those formats, all of them are embedded otherwise.\n";
+    out_file << "#if";
+    for (size_t i = 0; i < formats.size(); ++i) {
+      out_file << (i > 0 ? " && \\\n   " : "") << " !defined(" << formats[i]->define << ")";
+    }
+    out_file << "\n";
+    for (const Shader_Format* format : formats) out_file << "#define " << format->define << "\n";
+    out_file << "#endif\n\n";
+  }
+  for (const Shader_Format& format : SHADER_FORMATS) {
+    if (shaders.count(format.extension) > 0) continue;
+    out_file << "// No " << format.extension << " shaders were compiled, see 'build shaders'.\n";
+    out_file << "#undef " << format.define << "\n\n";
+  }
+
+  out_file << "// Of im3d_sdl3_gpu.hlsl when the shaders were compiled, the tests check it's up to date.\n";
+  out_file << "constexpr uint64_t im3d_shader_source_hash = 0x" << std::hex << std::setfill('0')
+           << std::setw(16) << hash_shader_source(source) << "ull;\n\n";
+
+  out_file << "// A shader in the pack of its format, the pack holds the shaders back to back.\n";
+  out_file << "struct Im3d_SDL3_GPU_Shader_Entry {\n";
+  out_file << "  const char* name;         // File name without the format, e.g. "
+              "\"im3d_lines.vert\".\n";
+  out_file << "  uint32_t    offset;       // Into the pack.\n";
+  out_file << "  uint32_t    packed_size;  // LZ4 block compressed when less than size.\n";
+  out_file << "  uint32_t    size;\n";
+  out_file << "  uint64_t    hash;         // FNV-1a of the uncompressed code.\n";
+  out_file << "};\n\n";
 
-    out_file << "constexpr uint8_t " << var_name << "[] = {\n";
-    for (size_t i = 0; i < data.size(); ++i) {
+  for (const Shader_Format& format : SHADER_FORMATS) {
+    auto format_shaders = shaders.find(format.extension);
+    if (format_shaders == shaders.end()) continue;
+
+    // Shaders with the same code are stored once.
+    std::vector<uint8_t>      pack;
+    std::vector<Shader_Entry> entries;
+    for (const auto& [name, data] : format_shaders->second) {
+      Shader_Entry shader_entry = {};
+      shader_entry.name         = name;
+      shader_entry.size         = static_cast<uint32_t>(data.size());
+      shader_entry.hash         = hash_shader_code(data);
+
+      auto same_code = std::find_if(entries.begin(), entries.end(), [&](const Shader_Entry& other) {
+        return other.hash == shader_entry.hash && format_shaders->second.at(other.name) == data;
+      });
+      if (same_code != entries.end()) {
+        shader_entry.offset      = same_code->offset;
+        shader_entry.packed_size = same_code->packed_size;
+        entries.push_back(shader_entry);
+        continue;
+      }
+
+      std::vector<uint8_t> packed = data;
+      if (compress_shaders) {
+        std::vector<uint8_t> compressed = compress(data);
+        if (compressed.size() < data.size()) packed = std::move(compressed);
+      }
+      shader_entry.offset      = static_cast<uint32_t>(pack.size());
+      shader_entry.packed_size = static_cast<uint32_t>(packed.size());
+      pack.insert(pack.end(), packed.begin(), packed.end());
+      entries.push_back(shader_entry);
+    }
+
+    out_file << "#ifdef " << format.define << "\n";
+    out_file << "constexpr uint8_t im3d_shader_pack_" << format.extension << "[] = {\n";
+    for (size_t i = 0; i < pack.size(); ++i) {
       if (i % 16 == 0) out_file << "  ";
       out_file << "0x" << std::hex << std::setfill('0') << std::setw(2)
-               << static_cast<int>(data[i]);
-      if (i + 1 < data.size()) out_file << ",";
-      if (i % 16 == 15 || i + 1 == data.size())
+               << static_cast<int>(pack[i]);
+      if (i + 1 < pack.size()) out_file << ",";
+      if (i % 16 == 15 || i + 1 == pack.size())
         out_file << "\n";
       else
         out_file << " ";
     }
     out_file << "};\n\n";
+
+    out_file << "constexpr Im3d_SDL3_GPU_Shader_Entry im3d_shader_table_" << format.extension
+             << "[] = {\n";
+    for (const Shader_Entry& shader_entry : entries) {
+      out_file << std::dec << "  {\"" << shader_entry.name << "\", " << shader_entry.offset << ", "
+               << shader_entry.packed_size << ", " << shader_entry.size << ", 0x" << std::hex
+               << std::setw(16) << shader_entry.hash << "ull},\n";
+    }
+    out_file << "};\n";
+    out_file << "#endif\n\n";
   }
 
   out_file << "// clang-format on\n";
@@ -0,0 +1,410 @@
+// Tests of the backend code that runs without a GPU device, 'build tests' builds and runs them.
+// The backend and the shader packer are included so their static functions can be called.
+
+#define OUT_DIR "."
+#define main    shaders_to_c_arrays_main
+#include "../src/shaders_to_c_arrays.cpp"
+#undef main
+
+#include "../src/im3d_sdl3_gpu.cpp"
+
+static int g_failures = 0;
+
+#define CHECK(condition)                                                               \
+  do {                                                                                 \
+    if (!(condition)) {                                                                \
+      SDL_LogError(SDL_LOG_CATEGORY_TEST, "%s:%d: %s", __FILE__, __LINE__, #condition); \
+      g_failures++;                                                                    \
+    }                                                                                  \
+  } while (0)
+
+// --- Shader Pack -------------------------------------------------------------
+
+static bool round_trips(const std::vector<uint8_t>& data) {
+  std::vector<uint8_t> packed = compress(data);
+  std::vector<uint8_t> unpacked(data.size() + 1);
+  return decompress_shader(
+             packed.data(),
+             uint32_t(packed.size()),
+             unpacked.data(),
+             uint32_t(data.size())) &&
+         std::equal(data.begin(), data.end(), unpacked.begin());
+}
+
+// Walks the sequences of an LZ4 block, false when a match breaks the end of block rules: the last
+// match starts at least 12 bytes before the end and the last 5 bytes are literals.
+static bool follows_end_of_block_rules(const std::vector<uint8_t>& packed, size_t size) {
+  size_t in  = 0;
+  size_t out = 0;
+  while (in < packed.size()) {
+    uint8_t token          = packed[in++];
+    size_t  literal_length = token >> 4;
+    if (literal_length == 15) {
+      for (uint8_t byte = 255; byte == 255; literal_length += byte) byte = packed[in++];
+    }
+    in  += literal_length;
+    out += literal_length;
+    if (in == packed.size()) { break; }
+
+    size_t match_length = token & 15;
+    in += 2;
+    if (match_length == 15) {
+      for (uint8_t byte = 255; byte == 255; match_length += byte) byte = packed[in++];
+    }
+    match_length += 4;
+    if (out + 12 > size || out + match_length + 5 > size) { return false; }
+    out += match_length;
+  }
+  return out == size;
+}
+
+static void test_shader_pack() {
+  std::vector<std::vector<uint8_t>> inputs;
+  inputs.push_back({});
+  inputs.push_back({42});
+  inputs.push_back(std::vector<uint8_t>(12, 7));
+  inputs.push_back(std::vector<uint8_t>(13, 7));
+  inputs.push_back(std::vector<uint8_t>(17, 7));
+  inputs.push_back(std::vector<uint8_t>(100000, 0));
+
+  // Literal runs and matches longer than 15 + 255, and repeats farther apart than 65535 bytes.
+  std::vector<uint8_t> mixed;
+  uint32_t             seed = 1;
+  for (int i = 0; i < 1000; i++) {
+    seed = seed * 1664525 + 1013904223;
+    mixed.push_back(uint8_t(seed >> 24));
+  }
+  mixed.insert(mixed.end(), 600, 'a');
+  std::vector<uint8_t> repeated = mixed;
+  mixed.resize(70000, 'b');
+  mixed.insert(mixed.end(), repeated.begin(), repeated.end());
+  inputs.push_back(mixed);
+
+  std::vector<uint8_t> ramp;
+  for (int i = 0; i < 4096; i++) ramp.push_back(uint8_t(i % 37));
+  inputs.push_back(ramp);
+
+  for (const std::vector<uint8_t>& data : inputs) {
+    CHECK(round_trips(data));
+    CHECK(follows_end_of_block_rules(compress(data), data.size()));
+  }
+  CHECK(compress(std::vector<uint8_t>(100000, 0)).size() < 1000);
+
+  // A block that decodes to a different size, or references bytes before the output, is rejected.
+  std::vector<uint8_t> data(64, 3);
+  std::vector<uint8_t> packed = compress(data);
+  std::vector<uint8_t> unpacked(128);
+  CHECK(!decompress_shader(packed.data(), uint32_t(packed.size()), unpacked.data(), 63));
+  CHECK(!decompress_shader(packed.data(), uint32_t(packed.size()), unpacked.data(), 65));
+  CHECK(!decompress_shader(packed.data(), uint32_t(packed.size() - 1), unpacked.data(), 64));
+  const uint8_t zero_offset[]   = {0x10, 'x', 0x00, 0x00, 0x50, 'x', 'x', 'x', 'x', 'x'};
+  const uint8_t past_start[]    = {0x10, 'x', 0x02, 0x00, 0x50, 'x', 'x', 'x', 'x', 'x'};
+  const uint8_t long_literals[] = {0xF0, 0x01};
+  CHECK(!decompress_shader(zero_offset, sizeof(zero_offset), unpacked.data(), 10));
+  CHECK(!decompress_shader(past_start, sizeof(past_start), unpacked.data(), 10));
+  CHECK(!decompress_shader(long_literals, sizeof(long_literals), unpacked.data(), 16));
+}
+
+// The embedded shaders must be compiled from the current source, 'build shaders' regenerates them.
+// The tests run from the build directory.
+static void test_shader_source_hash() {
+  std::ifstream source_file("../src/im3d_sdl3_gpu.hlsl", std::ios::binary);
+  CHECK(source_file.good());
+  std::vector<uint8_t> source(
+      (std::istreambuf_iterator<char>(source_file)),
+      std::istreambuf_iterator<char>());
+  CHECK(hash_shader_source(source) == im3d_shader_source_hash);
+}
+
+// --- Buffer Usage ------------------------------------------------------------
+
+static void test_storage_buffer_usage() {
+  g_data.init_info = {};
+  CHECK(storage_buffer_usage() == SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ);
+
+  // The cull and sort keys passes both read the vertex data and draws in a compute pass.
+  g_data.init_info.gpu_culling = true;
+  CHECK(storage_buffer_usage() & SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ);
+  g_data.init_info.gpu_culling = false;
+  g_data.init_info.gpu_sorting = true;
+  CHECK(storage_buffer_usage() & SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_READ);
+  g_data.init_info = {};
+}
+
+// --- Init --------------------------------------------------------------------
+
+static void test_init_rejects_overlay_depth() {
+  // Rejected before the device is used, the overlay has no depth for the scene to hide it with.
+  Im3d_SDL3_GPU_Init_Info info = {};
+  info.device                  = reinterpret_cast<SDL_GPUDevice*>(uintptr_t(1));
+  info.depth_stencil_format    = SDL_GPU_TEXTUREFORMAT_D32_FLOAT;
+  info.overlay_scale           = 0.5f;
+  CHECK(!im3d_sdl3_gpu_init(info));
+  CHECK(g_data.init_info.device == nullptr);
+}
+
+// --- Memory Budget -----------------------------------------------------------
+
+static void test_memory_budget() {
+  g_data.init_info                  = {};
+  g_data.memory_stats.current_bytes = 900;
+  CHECK(within_memory_budget(1 << 20, "test"));
+
+  g_data.init_info.memory_budget = 1000;
+  CHECK(within_memory_budget(100, "test"));
+  CHECK(!within_memory_budget(101, "test"));
+  CHECK(within_memory_budget(-100, "test"));
+
+  // Refused before any buffer is created, so the writers can drop their draws.
+  Upload_Ring ring         = {};
+  g_data.data_region_count = 2;
+  CHECK(!reserve_upload_ring(ring, 64, SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ, "test"));
+  CHECK(ring.buffer == nullptr && ring.region_size == 0);
+
+  g_data.init_info             = {};
+  g_data.memory_stats          = {};
+  g_data.data_region_count     = 0;
+  g_data.budget_warning_logged = false;
+}
+
+// --- Indexed Triangles -------------------------------------------------------
+
+static void test_expand_indexed_triangles() {
+  Im3d::DrawList draw_list = {};
+  draw_list.m_primType     = Im3d::DrawPrimitive_IndexedTriangles;
+  draw_list.m_vertexCount  = 4;
+  draw_list.m_indexCount   = 8;
+
+  // Only single sampled targets antialias triangle edges analytically.
+  g_data.init_info              = {};
+  g_data.init_info.msaa_samples = SDL_GPU_SAMPLECOUNT_4;
+  CHECK(!expand_indexed_triangles(draw_list));
+  g_data.init_info.overlay_scale = 0.5f;
+  CHECK(expand_indexed_triangles(draw_list));
+  g_data.init_info.msaa_samples  = SDL_GPU_SAMPLECOUNT_1;
+  g_data.init_info.overlay_scale = 0.0f;
+  CHECK(expand_indexed_triangles(draw_list));
+  draw_list.m_primType = Im3d::DrawPrimitive_Triangles;
+  CHECK(!expand_indexed_triangles(draw_list));
+
+  CHECK(fit_expanded_draw_list(draw_list, 100) == 6);
+  CHECK(fit_expanded_draw_list(draw_list, 5) == 3);
+  g_data.init_info = {};
+}
+
+// --- Draw Order --------------------------------------------------------------
+
+static void test_retained_layer_between() {
+  Retained_Layer layers[2]    = {};
+  layers[0].layer_index       = 2;
+  layers[1].layer_index       = 5;
+  g_data.retained_layers      = layers;
+  g_data.retained_layer_count = 2;
+
+  // A retained layer is pushed before the first list of a later layer.
+  CHECK(has_retained_layer_between(1, 3));
+  CHECK(has_retained_layer_between(2, 3));
+  CHECK(!has_retained_layer_between(3, 5));
+  CHECK(has_retained_layer_between(3, 6));
+  CHECK(!has_retained_layer_between(3, 3));
+
+  g_data.retained_layers      = nullptr;
+  g_data.retained_layer_count = 0;
+}
+
+// --- Depth Runs --------------------------------------------------------------
+
+static void test_depth_runs() {
+  Im3d::Id layer_id = Im3d::MakeId("test_depth_runs");
+  im3d_sdl3_gpu_set_layer_depth_mode(layer_id, IM3D_SDL3_GPU_DEPTH_MODE_OFF);
+
+  // Consecutive records of one depth mode share a run.
+  Depth_Runs runs = {};
+  CHECK(push_depth_run(runs, 0, 2) != nullptr);
+  CHECK(push_depth_run(runs, 2, 1) != nullptr);
+  Im3d::PushLayerId(layer_id);
+  CHECK(push_depth_run(runs, 3, 4) != nullptr);
+  Im3d::PopLayerId();
+  CHECK(push_depth_run(runs, 7, 1) != nullptr);
+  CHECK(runs.count == 3);
+  CHECK(runs.runs[0].depth_mode == IM3D_SDL3_GPU_DEPTH_MODE_DEFAULT && runs.runs[0].count == 3);
+  CHECK(runs.runs[1].depth_mode == IM3D_SDL3_GPU_DEPTH_MODE_OFF && runs.runs[1].first == 3);
+  CHECK(runs.runs[2].depth_mode == IM3D_SDL3_GPU_DEPTH_MODE_DEFAULT && runs.runs[2].first == 7);
+
+  Depth_Runs draw_runs = {};
+  swap_depth_runs(runs, draw_runs);
+  CHECK(runs.count == 0 && draw_runs.count == 3);
+
+  release_depth_runs(runs);
+  release_depth_runs(draw_runs);
+  SDL_free(g_data.layer_infos);
+  g_data.layer_infos      = nullptr;
+  g_data.layer_info_count = 0;
+}
+
+static void test_shape_depth_runs() {
+  Im3d::Id layer_id = Im3d::MakeId("test_shape_depth_runs");
+  im3d_sdl3_gpu_set_layer_depth_mode(layer_id, IM3D_SDL3_GPU_DEPTH_MODE_OFF);
+
+  Im3d_SDL3_GPU_Shape shape = {};
+  shape.type                = IM3D_SDL3_GPU_SHAPE_SPHERE;
+  shape.detail              = 8;
+  im3d_sdl3_gpu_draw_shapes(&shape, 1);
+  Im3d::PushLayerId(layer_id);
+  im3d_sdl3_gpu_draw_shapes(&shape, 1);
+  im3d_sdl3_gpu_draw_shapes(&shape, 1);
+  Im3d::PopLayerId();
+
+  // Each run is drawn on its own, so its first lines start again at 0.
+  CHECK(g_data.shape_runs.count == 2);
+  CHECK(g_data.shape_runs.runs[1].first == 1 && g_data.shape_runs.runs[1].count == 2);
+  CHECK(g_data.shape_runs.runs[1].line_count == 2 * 3 * 8);
+  CHECK(g_data.shapes[1].first_line == 0 && g_data.shapes[2].first_line == 3 * 8);
+
+  // Filled shapes without an impostor are skipped without a record or a run.
+  shape.type = IM3D_SDL3_GPU_SHAPE_CONE;
+  im3d_sdl3_gpu_draw_filled_shapes(&shape, 1);
+  shape.type = IM3D_SDL3_GPU_SHAPE_CAPSULE;
+  im3d_sdl3_gpu_draw_filled_shapes(&shape, 1);
+  Im3d::PushLayerId(layer_id);
+  im3d_sdl3_gpu_draw_filled_shapes(&shape, 1);
+  Im3d::PopLayerId();
+  CHECK(g_data.impostor_count == 2 && g_data.impostor_runs.count == 2);
+  CHECK(g_data.impostor_runs.runs[1].depth_mode == IM3D_SDL3_GPU_DEPTH_MODE_OFF);
+  CHECK(g_data.impostor_runs.runs[1].first == 1);
+
+  SDL_free(g_data.impostors);
+  release_depth_runs(g_data.impostor_runs);
+  g_data.impostors         = nullptr;
+  g_data.impostor_capacity = 0;
+  g_data.impostor_count    = 0;
+  SDL_free(g_data.shapes);
+  release_depth_runs(g_data.shape_runs);
+  g_data.shapes           = nullptr;
+  g_data.shape_capacity   = 0;
+  g_data.shape_count      = 0;
+  SDL_free(g_data.layer_infos);
+  g_data.layer_infos      = nullptr;
+  g_data.layer_info_count = 0;
+}
+
+// --- Text --------------------------------------------------------------------
+
+static bool decodes_to(const char* text, uint32_t codepoint, size_t length) {
+  const char* end = text + std::strlen(text);
+  const char* c   = text;
+  return decode_utf8(c, end) == codepoint && size_t(c - text) == length;
+}
+
+static void test_decode_utf8() {
+  CHECK(decodes_to("A", 'A', 1));
+  CHECK(decodes_to("\xC3\xA9", 0xE9, 2));
+  CHECK(decodes_to("\xE2\x82\xAC", 0x20AC, 3));
+  CHECK(decodes_to("\xF0\x9F\x98\x80", 0x1F600, 4));
+
+  CHECK(decodes_to("\xED\x9F\xBF", 0xD7FF, 3));
+  CHECK(decodes_to("\xF4\x8F\xBF\xBF", 0x10FFFF, 4));
+
+  // Invalid sequences decode to U+FFFD and only skip the bytes read so far.
+  CHECK(decodes_to("\x80", 0xFFFD, 1));
+  CHECK(decodes_to("\xC3" "A", 0xFFFD, 1));
+  CHECK(decodes_to("\xE2\x82", 0xFFFD, 1));
+  CHECK(decodes_to("\xF0\x9F" "AB", 0xFFFD, 2));
+
+  // Overlong encodings, surrogates, codepoints above U+10FFFF and leads above 0xF4 are invalid.
+  CHECK(decodes_to("\xC0\x80", 0xFFFD, 1));
+  CHECK(decodes_to("\xC1\xBF", 0xFFFD, 1));
+  CHECK(decodes_to("\xE0\x9F\xBF", 0xFFFD, 1));
+  CHECK(decodes_to("\xF0\x8F\xBF\xBF", 0xFFFD, 1));
+  CHECK(decodes_to("\xED\xA0\x80", 0xFFFD, 1));
+  CHECK(decodes_to("\xED\xBF\xBF", 0xFFFD, 1));
+  CHECK(decodes_to("\xF4\x90\x80\x80", 0xFFFD, 1));
+  CHECK(decodes_to("\xF5\x80\x80\x80", 0xFFFD, 1));
+  CHECK(decodes_to("\xF8\x88\x80\x80\x80", 0xFFFD, 1));
+  CHECK(decodes_to("\xFF", 0xFFFD, 1));
+}
+
+// A font of a few glyphs set up like im3d_sdl3_gpu_set_font does, without the GPU resources.
+static Im3d_SDL3_GPU_Glyph g_test_glyphs[] = {
+    {' ', {}, {0.0f, 0.0f, 0.0f, 0.0f}, 0.25f},
+    {'?', {}, {0.0f, 0.0f, 0.5f, 1.0f}, 0.5f},
+    {'A', {}, {0.0f, 0.0f, 0.5f, 1.0f}, 0.5f},
+    {'B', {}, {0.0f, 0.0f, 1.0f, 1.0f}, 1.0f},
+    {0xE9, {}, {0.0f, 0.0f, 0.75f, 1.0f}, 0.75f},
+};
+
+static void set_test_font() {
+  g_data.font_line_height    = 1.25f;
+  g_data.font_glyphs         = g_test_glyphs;
+  g_data.font_glyph_count    = SDL_arraysize(g_test_glyphs);
+  g_data.font_fallback_glyph = search_glyph('?');
+  for (uint32_t i = 0; i < SDL_arraysize(g_data.font_ascii_glyphs); i++) {
+    const Im3d_SDL3_GPU_Glyph* glyph = search_glyph(i);
+    g_data.font_ascii_glyphs[i]      = glyph != nullptr ? glyph : g_data.font_fallback_glyph;
+  }
+}
+
+static bool has_glyph(const Text_Run_Glyph& glyph, uint32_t codepoint, float x, float y) {
+  return g_test_glyphs[glyph.glyph].codepoint == codepoint && glyph.offset.x == x &&
+         glyph.offset.y == y;
+}
+
+static void test_layout_text() {
+  set_test_font();
+  Text_Run_Glyph glyphs[8];
+
+  // Centered on the position by default, every flag moves the text to one side of it.
+  CHECK(layout_text("AB", 2, Im3d::TextFlags_Default, glyphs) == 2);
+  CHECK(has_glyph(glyphs[0], 'A', -0.75f, -0.625f));
+  CHECK(has_glyph(glyphs[1], 'B', -0.25f, -0.625f));
+  CHECK(layout_text("AB", 2, Im3d::TextFlags_AlignLeft, glyphs) == 2);
+  CHECK(has_glyph(glyphs[0], 'A', -1.5f, -0.625f));
+  CHECK(layout_text("AB", 2, Im3d::TextFlags_AlignRight, glyphs) == 2);
+  CHECK(has_glyph(glyphs[0], 'A', 0.0f, -0.625f));
+  CHECK(layout_text("AB", 2, Im3d::TextFlags_AlignTop, glyphs) == 2);
+  CHECK(has_glyph(glyphs[0], 'A', -0.75f, -1.25f));
+  CHECK(layout_text("AB", 2, Im3d::TextFlags_AlignBottom, glyphs) == 2);
+  CHECK(has_glyph(glyphs[0], 'A', -0.75f, 0.0f));
+
+  // Each line is aligned on its own, the lines as a whole are aligned vertically.
+  CHECK(layout_text("A\nBB", 4, Im3d::TextFlags_AlignBottom, glyphs) == 3);
+  CHECK(has_glyph(glyphs[0], 'A', -0.25f, 0.0f));
+  CHECK(has_glyph(glyphs[1], 'B', -1.0f, 1.25f));
+  CHECK(has_glyph(glyphs[2], 'B', 0.0f, 1.25f));
+  CHECK(layout_text("A\nBB", 4, Im3d::TextFlags_AlignTop, glyphs) == 3);
+  CHECK(has_glyph(glyphs[0], 'A', -0.25f, -2.5f));
+  CHECK(has_glyph(glyphs[1], 'B', -1.0f, -1.25f));
+
+  // Spaces only advance, missing glyphs are drawn as '?' and UTF-8 is decoded.
+  CHECK(layout_text("A B", 3, Im3d::TextFlags_AlignRight, glyphs) == 2);
+  CHECK(has_glyph(glyphs[1], 'B', 0.75f, -0.625f));
+  CHECK(layout_text("Z\xC3\xA9", 3, Im3d::TextFlags_AlignRight, glyphs) == 2);
+  CHECK(has_glyph(glyphs[0], '?', 0.0f, -0.625f));
+  CHECK(has_glyph(glyphs[1], 0xE9, 0.5f, -0.625f));
+  CHECK(layout_text("\xFF" "A", 2, Im3d::TextFlags_AlignRight, glyphs) == 2);
+  CHECK(has_glyph(glyphs[0], '?', 0.0f, -0.625f));
+  CHECK(has_glyph(glyphs[1], 'A', 0.5f, -0.625f));
+
+  g_data.font_glyphs      = nullptr;
+  g_data.font_glyph_count = 0;
+}
+
+int main() {
+  test_shader_pack();
+  test_shader_source_hash();
+  test_storage_buffer_usage();
+  test_init_rejects_overlay_depth();
+  test_memory_budget();
+  test_expand_indexed_triangles();
+  test_retained_layer_between();
+  test_depth_runs();
+  test_shape_depth_runs();
+  test_decode_utf8();
+  test_layout_text();
+  if (g_failures > 0) {
+    SDL_LogError(SDL_LOG_CATEGORY_TEST, "%d checks failed", g_failures);
+    return 1;
+  }
+  SDL_Log("All tests passed");
+  return 0;
+}